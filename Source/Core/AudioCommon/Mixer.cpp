@@ -6,15 +6,72 @@
 #include <algorithm>
 #include <cmath>
 #include <cstring>
+#include <numeric>
 
 #include "AudioCommon/Enums.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/Intrinsics.h"
 #include "Common/Logging/Log.h"
+#include "Common/MathUtil.h"
 #include "Common/Swap.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 
+namespace
+{
+// Number of input frames the windowed sinc resampler looks at for every output frame.
+constexpr u32 SINC_TAPS = 8;
+constexpr u32 SINC_PHASE_BITS = 8;
+constexpr u32 SINC_PHASES = 1 << SINC_PHASE_BITS;
+
+// Lanczos kernel (a = SINC_TAPS / 2) for every fractional position, normalized to unity gain.
+// Each coefficient is stored twice in a row, matching the layout of interleaved stereo frames.
+struct SincTable
+{
+  SincTable()
+  {
+    constexpr double a = SINC_TAPS / 2;
+    const auto sinc = [](double x) {
+      return x == 0.0 ? 1.0 : std::sin(MathUtil::PI * x) / (MathUtil::PI * x);
+    };
+
+    for (u32 phase = 0; phase < SINC_PHASES; ++phase)
+    {
+      const double frac = static_cast<double>(phase) / SINC_PHASES;
+      std::array<double, SINC_TAPS> kernel;
+      for (u32 k = 0; k < SINC_TAPS; ++k)
+      {
+        const double x = frac - (static_cast<double>(k) - (a - 1));
+        kernel[k] = std::abs(x) < a ? sinc(x) * sinc(x / a) : 0.0;
+      }
+
+      const double sum = std::accumulate(kernel.begin(), kernel.end(), 0.0);
+      for (u32 k = 0; k < SINC_TAPS; ++k)
+      {
+        const float coeff = static_cast<float>(kernel[k] / sum);
+        coeffs[(phase * SINC_TAPS + k) * 2] = coeff;
+        coeffs[(phase * SINC_TAPS + k) * 2 + 1] = coeff;
+      }
+    }
+  }
+
+  alignas(16) std::array<float, SINC_PHASES * SINC_TAPS * 2> coeffs;
+};
+
+const float* GetSincCoefficients(u32 frac)
+{
+  static const SincTable table;
+  return &table.coeffs[(frac >> (16 - SINC_PHASE_BITS)) * SINC_TAPS * 2];
+}
+
+void ClampSamples(short* out, const s32* in, size_t count)
+{
+  for (size_t i = 0; i < count; ++i)
+    out[i] = static_cast<short>(std::clamp(in[i], -32767, 32767));
+}
+}  // namespace
+
 static u32 DPL2QualityToFrameBlockSize(AudioCommon::DPL2Quality quality)
 {
   switch (quality)
@@ -56,35 +113,33 @@ void Mixer::DoState(PointerWrap& p)
 }
 
 // Executed from sound stream thread
-unsigned int Mixer::MixerFifo::Mix(short* samples, unsigned int numSamples,
-                                   bool consider_framelimit, float emulationspeed,
-                                   int timing_variance)
-{
-  unsigned int currentSample = 0;
-
-  // Cache access in non-volatile variable
-  // This is the only function changing the read value, so it's safe to
-  // cache it locally although it's written here.
-  // The writing pointer will be modified outside, but it will only increase,
-  // so we will just ignore new written data while interpolating.
-  // Without this cache, the compiler wouldn't be allowed to optimize the
-  // interpolation loop.
-  u32 indexR = m_indexR.load();
-  u32 indexW = m_indexW.load();
-
-  // render numleft sample pairs to samples[]
-  // advance indexR with sample position
-  // remember fractional offset
+unsigned int Mixer::MixerFifo::Mix(s32* samples, unsigned int numSamples, bool consider_framelimit,
+                                   float emulationspeed, int timing_variance, bool sinc_resampling)
+{
+  // This is the only function changing the read index, so it doesn't need to be synchronized.
+  // The write index only ever increases, so anything pushed while we are resampling is simply
+  // picked up by the next call. The acquire pairs with the release in PushSamples and makes
+  // the pushed samples visible to this thread.
+  u32 indexR = m_indexR.load(std::memory_order_relaxed);
+  const u32 indexW = m_indexW.load(std::memory_order_acquire);
+  const u32 available_frames = ((indexW - indexR) & INDEX_MASK) / 2;
 
   float aid_sample_rate =
       FIXED_SAMPLE_RATE_DIVIDEND / static_cast<float>(m_input_sample_rate_divisor);
   if (consider_framelimit && emulationspeed > 0.0f)
   {
-    float numLeft = static_cast<float>(((indexW - indexR) & INDEX_MASK) / 2);
+    float numLeft = static_cast<float>(available_frames);
 
     u32 low_watermark = (FIXED_SAMPLE_RATE_DIVIDEND * timing_variance) /
                         (static_cast<u64>(m_input_sample_rate_divisor) * 1000);
     low_watermark = std::min(low_watermark, MAX_SAMPLES / 2);
+    if (m_mixer->m_config_adaptive_latency)
+    {
+      if (m_adaptive_watermark == 0)
+        m_adaptive_watermark = low_watermark;
+      low_watermark = m_adaptive_watermark;
+    }
+    m_target_frames.store(low_watermark, std::memory_order_relaxed);
 
     m_numLeftI = (numLeft + m_numLeftI * (CONTROL_AVG - 1)) / CONTROL_AVG;
     float offset = (m_numLeftI - low_watermark) * CONTROL_FACTOR;
@@ -101,56 +156,195 @@ unsigned int Mixer::MixerFifo::Mix(short* samples, unsigned int numSamples,
   s32 lvolume = m_LVolume.load();
   s32 rvolume = m_RVolume.load();
 
+  // Copy the frames this call can consume to a linear buffer first, so that the resampling
+  // loops don't have to deal with wrapping around and byte swapping for every sample.
+  const u32 taps = sinc_resampling ? SINC_TAPS : 2;
+  const u64 wanted_frames = ((m_frac + u64(numSamples) * ratio) >> 16) + taps;
+  const u32 num_frames = static_cast<u32>(std::min<u64>(available_frames, wanted_frames));
+  s16* const frames = m_mixer->m_fifo_frames.data();
+  ReadFrames(indexR, num_frames, frames);
+
+  u32 position = 0;
+  const u32 actual_sample_count =
+      sinc_resampling ?
+          ResampleSinc(samples, numSamples, frames, num_frames, ratio, lvolume, rvolume, position) :
+          ResampleLinear(samples, numSamples, frames, num_frames, ratio, lvolume, rvolume,
+                         position);
+  indexR += position * 2;
+
+  // Running dry is only an underrun if there was audio before, not while nothing is playing.
+  const bool underrun = m_had_samples && actual_sample_count < numSamples;
+  if (underrun)
+    m_underruns.fetch_add(1, std::memory_order_relaxed);
+  if (consider_framelimit && m_mixer->m_config_adaptive_latency)
+    UpdateAdaptiveWatermark(available_frames, position, underrun);
+  m_had_samples = available_frames != 0;
+  m_buffered_frames.store(available_frames - position, std::memory_order_relaxed);
+
   const auto read_buffer = [this](auto index) {
     return m_little_endian ? m_buffer[index] : Common::swap16(m_buffer[index]);
   };
 
-  // TODO: consider a higher-quality resampling algorithm.
-  for (; currentSample < numSamples * 2 && ((indexW - indexR) & INDEX_MASK) > 2; currentSample += 2)
+  // Padding
+  short s[2];
+  s[0] = read_buffer((indexR - 1) & INDEX_MASK);
+  s[1] = read_buffer((indexR - 2) & INDEX_MASK);
+  s[0] = (s[0] * rvolume) >> 8;
+  s[1] = (s[1] * lvolume) >> 8;
+  for (unsigned int currentSample = actual_sample_count * 2; currentSample < numSamples * 2;
+       currentSample += 2)
+  {
+    samples[currentSample + 0] += s[0];
+    samples[currentSample + 1] += s[1];
+  }
+
+  // The release makes sure we are done reading the consumed samples before PushSamples can
+  // overwrite them.
+  m_indexR.store(indexR, std::memory_order_release);
+
+  return actual_sample_count;
+}
+
+void Mixer::MixerFifo::UpdateAdaptiveWatermark(u32 available_frames, u32 consumed_frames,
+                                               bool underrun)
+{
+  // Length of a measurement window, and the least amount of audio that is always kept buffered
+  // on top of what a single Mix call consumes.
+  const u32 window_length = FIXED_SAMPLE_RATE_DIVIDEND / m_input_sample_rate_divisor / 2;
+  const u32 min_watermark = FIXED_SAMPLE_RATE_DIVIDEND / m_input_sample_rate_divisor / 1000;
+
+  if (underrun)
+  {
+    m_adaptive_watermark =
+        std::min(m_adaptive_watermark + std::max(consumed_frames, min_watermark), MAX_SAMPLES / 2);
+    m_window_frames = 0;
+    m_window_min_slack = MAX_SAMPLES;
+    DEBUG_LOG_FMT(AUDIO, "Mixer underrun, raising watermark to {} frames", m_adaptive_watermark);
+    return;
+  }
+
+  m_window_min_slack = std::min(m_window_min_slack, available_frames - consumed_frames);
+  m_window_frames += consumed_frames;
+  if (m_window_frames < window_length)
+    return;
+
+  // The FIFO never had less than m_window_min_slack frames left over, so the watermark can be
+  // lowered by part of that without risking an underrun, as long as the jitter stays the same.
+  const u32 margin = std::max(consumed_frames, min_watermark);
+  if (m_window_min_slack > margin)
+  {
+    const u32 reduction = (m_window_min_slack - margin) / 2;
+    const u32 lowered = m_adaptive_watermark - std::min(reduction, m_adaptive_watermark);
+    m_adaptive_watermark = std::max(lowered, min_watermark);
+  }
+  m_window_frames = 0;
+  m_window_min_slack = MAX_SAMPLES;
+}
+
+void Mixer::MixerFifo::ReadFrames(u32 index, u32 num_frames, s16* frames) const
+{
+  const u32 start = index & INDEX_MASK;
+  const u32 count = num_frames * 2;
+  const u32 before_wrap = std::min(count, MAX_SAMPLES * 2 - start);
+  std::copy_n(&m_buffer[start], before_wrap, frames);
+  std::copy_n(&m_buffer[0], count - before_wrap, frames + before_wrap);
+
+  if (!m_little_endian)
   {
-    u32 indexR2 = indexR + 2;  // next sample
+    for (u32 i = 0; i < count; ++i)
+      frames[i] = Common::swap16(frames[i]);
+  }
+}
 
-    s16 l1 = read_buffer(indexR & INDEX_MASK);   // current
-    s16 l2 = read_buffer(indexR2 & INDEX_MASK);  // next
+u32 Mixer::MixerFifo::ResampleLinear(s32* samples, u32 num_samples, const s16* frames,
+                                     u32 num_frames, u32 ratio, s32 lvolume, s32 rvolume,
+                                     u32& position)
+{
+  u32 i = 0;
+  for (; i < num_samples && position + 2 <= num_frames; ++i)
+  {
+    const s16* const current = &frames[position * 2];
+
+    s16 l1 = current[0];  // current
+    s16 l2 = current[2];  // next
     int sampleL = ((l1 << 16) + (l2 - l1) * (u16)m_frac) >> 16;
-    sampleL = (sampleL * lvolume) >> 8;
-    sampleL += samples[currentSample + 1];
-    samples[currentSample + 1] = std::clamp(sampleL, -32767, 32767);
+    samples[i * 2 + 1] += (sampleL * lvolume) >> 8;
 
-    s16 r1 = read_buffer((indexR + 1) & INDEX_MASK);   // current
-    s16 r2 = read_buffer((indexR2 + 1) & INDEX_MASK);  // next
+    s16 r1 = current[1];  // current
+    s16 r2 = current[3];  // next
     int sampleR = ((r1 << 16) + (r2 - r1) * (u16)m_frac) >> 16;
-    sampleR = (sampleR * rvolume) >> 8;
-    sampleR += samples[currentSample];
-    samples[currentSample] = std::clamp(sampleR, -32767, 32767);
+    samples[i * 2] += (sampleR * rvolume) >> 8;
 
     m_frac += ratio;
-    indexR += 2 * (u16)(m_frac >> 16);
+    position += m_frac >> 16;
     m_frac &= 0xffff;
   }
+  return i;
+}
 
-  // Actual number of samples written to the buffer without padding.
-  unsigned int actual_sample_count = currentSample / 2;
-
-  // Padding
-  short s[2];
-  s[0] = read_buffer((indexR - 1) & INDEX_MASK);
-  s[1] = read_buffer((indexR - 2) & INDEX_MASK);
-  s[0] = (s[0] * rvolume) >> 8;
-  s[1] = (s[1] * lvolume) >> 8;
-  for (; currentSample < numSamples * 2; currentSample += 2)
+// Windowed sinc resampling. The output position lies between frames 3 and 4 of the SINC_TAPS
+// frames starting at <position>, which delays the output by a few frames compared to the linear
+// resampler, but means that no frames behind the read index are needed.
+u32 Mixer::MixerFifo::ResampleSinc(s32* samples, u32 num_samples, const s16* frames,
+                                   u32 num_frames, u32 ratio, s32 lvolume, s32 rvolume,
+                                   u32& position)
+{
+  u32 i = 0;
+  for (; i < num_samples && position + SINC_TAPS <= num_frames; ++i)
   {
-    int sampleR = std::clamp(s[0] + samples[currentSample + 0], -32767, 32767);
-    int sampleL = std::clamp(s[1] + samples[currentSample + 1], -32767, 32767);
+    const float* const coeffs = GetSincCoefficients(m_frac);
+    const s16* const input = &frames[position * 2];
+
+#ifdef _M_X86
+    __m128 sum = _mm_setzero_ps();
+    for (u32 k = 0; k < SINC_TAPS * 2; k += 8)
+    {
+      const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + k));
+      const __m128 lo = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(in, in), 16));
+      const __m128 hi = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(in, in), 16));
+      sum = _mm_add_ps(sum, _mm_mul_ps(lo, _mm_load_ps(coeffs + k)));
+      sum = _mm_add_ps(sum, _mm_mul_ps(hi, _mm_load_ps(coeffs + k + 4)));
+    }
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    const int sampleL = _mm_cvttss_si32(sum);
+    const int sampleR = _mm_cvttss_si32(_mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1)));
+#else
+    float sumL = 0.0f;
+    float sumR = 0.0f;
+    for (u32 k = 0; k < SINC_TAPS * 2; k += 2)
+    {
+      sumL += input[k] * coeffs[k];
+      sumR += input[k + 1] * coeffs[k + 1];
+    }
+    const int sampleL = static_cast<int>(sumL);
+    const int sampleR = static_cast<int>(sumR);
+#endif
 
-    samples[currentSample + 0] = sampleR;
-    samples[currentSample + 1] = sampleL;
+    samples[i * 2 + 1] += (sampleL * lvolume) >> 8;
+    samples[i * 2] += (sampleR * rvolume) >> 8;
+
+    m_frac += ratio;
+    position += m_frac >> 16;
+    m_frac &= 0xffff;
   }
+  return i;
+}
 
-  // Flush cached variable
-  m_indexR.store(indexR);
+void Mixer::MixAll(s32* samples, unsigned int num_samples, bool consider_framelimit)
+{
+  std::fill_n(samples, num_samples * 2, 0);
 
-  return actual_sample_count;
+  const float emulation_speed = m_config_emulation_speed;
+  const int timing_variance = m_config_timing_variance;
+  const bool sinc = m_config_sinc_resampling;
+  m_dma_mixer.Mix(samples, num_samples, consider_framelimit, emulation_speed, timing_variance,
+                  sinc);
+  m_streaming_mixer.Mix(samples, num_samples, consider_framelimit, emulation_speed,
+                        timing_variance, sinc);
+  m_wiimote_speaker_mixer.Mix(samples, num_samples, consider_framelimit, emulation_speed,
+                              timing_variance, sinc);
+  for (auto& mixer : m_gba_mixers)
+    mixer.Mix(samples, num_samples, consider_framelimit, emulation_speed, timing_variance, sinc);
 }
 
 unsigned int Mixer::Mix(short* samples, unsigned int num_samples)
@@ -160,26 +354,14 @@ unsigned int Mixer::Mix(short* samples, unsigned int num_samples)
 
   memset(samples, 0, num_samples * 2 * sizeof(short));
 
-  const float emulation_speed = m_config_emulation_speed;
-  const int timing_variance = m_config_timing_variance;
   if (m_config_audio_stretch)
   {
     unsigned int available_samples =
-        std::min(m_dma_mixer.AvailableSamples(), m_streaming_mixer.AvailableSamples());
+        std::min({m_dma_mixer.AvailableSamples(), m_streaming_mixer.AvailableSamples(),
+                  MAX_SAMPLES});
 
-    m_scratch_buffer.fill(0);
-
-    m_dma_mixer.Mix(m_scratch_buffer.data(), available_samples, false, emulation_speed,
-                    timing_variance);
-    m_streaming_mixer.Mix(m_scratch_buffer.data(), available_samples, false, emulation_speed,
-                          timing_variance);
-    m_wiimote_speaker_mixer.Mix(m_scratch_buffer.data(), available_samples, false, emulation_speed,
-                                timing_variance);
-    for (auto& mixer : m_gba_mixers)
-    {
-      mixer.Mix(m_scratch_buffer.data(), available_samples, false, emulation_speed,
-                timing_variance);
-    }
+    MixAll(m_accumulator.data(), available_samples, false);
+    ClampSamples(m_scratch_buffer.data(), m_accumulator.data(), available_samples * 2);
 
     if (!m_is_stretching)
     {
@@ -191,11 +373,12 @@ unsigned int Mixer::Mix(short* samples, unsigned int num_samples)
   }
   else
   {
-    m_dma_mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
-    m_streaming_mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
-    m_wiimote_speaker_mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
-    for (auto& mixer : m_gba_mixers)
-      mixer.Mix(samples, num_samples, true, emulation_speed, timing_variance);
+    for (unsigned int offset = 0; offset < num_samples; offset += MAX_SAMPLES)
+    {
+      const unsigned int count = std::min(num_samples - offset, MAX_SAMPLES);
+      MixAll(m_accumulator.data(), count, true);
+      ClampSamples(samples + offset * 2, m_accumulator.data(), count * 2);
+    }
     m_is_stretching = false;
   }
 
@@ -228,15 +411,17 @@ unsigned int Mixer::MixSurround(float* samples, unsigned int num_samples)
 
 void Mixer::MixerFifo::PushSamples(const short* samples, unsigned int num_samples)
 {
-  // Cache access in non-volatile variable
-  // indexR isn't allowed to cache in the audio throttling loop as it
-  // needs to get updates to not deadlock.
-  u32 indexW = m_indexW.load();
+  // This is the only function changing the write index. The acquire pairs with the release in
+  // Mix, so the space freed by the audio thread can't be overwritten while it is still read.
+  u32 indexW = m_indexW.load(std::memory_order_relaxed);
 
   // Check if we have enough free space
   // indexW == m_indexR results in empty buffer, so indexR must always be smaller than indexW
-  if (num_samples * 2 + ((indexW - m_indexR.load()) & INDEX_MASK) >= MAX_SAMPLES * 2)
+  if (num_samples * 2 + ((indexW - m_indexR.load(std::memory_order_acquire)) & INDEX_MASK) >=
+      MAX_SAMPLES * 2)
+  {
     return;
+  }
 
   // AyuanX: Actual re-sampling work has been moved to sound thread
   // to alleviate the workload on main thread
@@ -252,7 +437,7 @@ void Mixer::MixerFifo::PushSamples(const short* samples, unsigned int num_sample
     memcpy(&m_buffer[indexW & INDEX_MASK], samples, num_samples * 4);
   }
 
-  m_indexW.fetch_add(num_samples * 2);
+  m_indexW.store(indexW + num_samples * 2, std::memory_order_release);
 }
 
 void Mixer::PushSamples(const short* samples, unsigned int num_samples)
@@ -412,6 +597,16 @@ void Mixer::RefreshConfig()
   m_config_emulation_speed = Config::Get(Config::MAIN_EMULATION_SPEED);
   m_config_timing_variance = Config::Get(Config::MAIN_TIMING_VARIANCE);
   m_config_audio_stretch = Config::Get(Config::MAIN_AUDIO_STRETCH);
+  m_config_sinc_resampling = Config::Get(Config::MAIN_AUDIO_SINC_RESAMPLING);
+  m_config_adaptive_latency = Config::Get(Config::MAIN_AUDIO_ADAPTIVE_LATENCY);
+}
+
+Mixer::LatencyStats Mixer::GetLatencyStats() const
+{
+  const float frames_per_ms =
+      FIXED_SAMPLE_RATE_DIVIDEND / 1000.0f / m_dma_mixer.GetInputSampleRateDivisor();
+  return {m_dma_mixer.GetBufferedFrames() / frames_per_ms,
+          m_dma_mixer.GetTargetFrames() / frames_per_ms, m_dma_mixer.GetUnderrunCount()};
 }
 
 void Mixer::MixerFifo::DoState(PointerWrap& p)
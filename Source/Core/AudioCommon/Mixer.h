@@ -48,6 +48,15 @@ public:
   void StartLogDSPAudio(const std::string& filename);
   void StopLogDSPAudio();
 
+  struct LatencyStats
+  {
+    // Audio currently buffered in the DMA FIFO and the fill level the mixer is aiming for.
+    float buffered_ms;
+    float target_ms;
+    u64 underruns;
+  };
+  LatencyStats GetLatencyStats() const;
+
   float GetCurrentSpeed() const { return m_speed.load(); }
   void UpdateSpeed(float val) { m_speed.store(val); }
 
@@ -73,29 +82,57 @@ private:
     }
     void DoState(PointerWrap& p);
     void PushSamples(const short* samples, unsigned int num_samples);
-    unsigned int Mix(short* samples, unsigned int numSamples, bool consider_framelimit,
-                     float emulationspeed, int timing_variance);
+    // Adds the resampled samples to <samples> without clamping.
+    unsigned int Mix(s32* samples, unsigned int numSamples, bool consider_framelimit,
+                     float emulationspeed, int timing_variance, bool sinc_resampling);
     void SetInputSampleRateDivisor(unsigned int rate_divisor);
     unsigned int GetInputSampleRateDivisor() const;
     void SetVolume(unsigned int lvolume, unsigned int rvolume);
     std::pair<s32, s32> GetVolume() const;
     unsigned int AvailableSamples() const;
+    u32 GetBufferedFrames() const { return m_buffered_frames.load(std::memory_order_relaxed); }
+    u32 GetTargetFrames() const { return m_target_frames.load(std::memory_order_relaxed); }
+    u64 GetUnderrunCount() const { return m_underruns.load(std::memory_order_relaxed); }
 
   private:
+    void UpdateAdaptiveWatermark(u32 available_frames, u32 consumed_frames, bool underrun);
+
+    void ReadFrames(u32 index, u32 num_frames, s16* frames) const;
+    // Both return the number of samples written and advance <position> by the number of
+    // frames that were consumed.
+    u32 ResampleLinear(s32* samples, u32 num_samples, const s16* frames, u32 num_frames,
+                       u32 ratio, s32 lvolume, s32 rvolume, u32& position);
+    u32 ResampleSinc(s32* samples, u32 num_samples, const s16* frames, u32 num_frames, u32 ratio,
+                     s32 lvolume, s32 rvolume, u32& position);
+
     Mixer* m_mixer;
     unsigned m_input_sample_rate_divisor;
     bool m_little_endian;
     std::array<short, MAX_SAMPLES * 2> m_buffer{};
-    std::atomic<u32> m_indexW{0};
-    std::atomic<u32> m_indexR{0};
+    // Single producer, single consumer: only PushSamples writes m_indexW and only Mix writes
+    // m_indexR. They live on separate cache lines so that the emulation thread pushing samples
+    // doesn't keep stealing the line the audio thread is reading.
+    alignas(64) std::atomic<u32> m_indexW{0};
+    alignas(64) std::atomic<u32> m_indexR{0};
     // Volume ranges from 0-256
     std::atomic<s32> m_LVolume{256};
     std::atomic<s32> m_RVolume{256};
     float m_numLeftI = 0.0f;
     u32 m_frac = 0;
+
+    // Adaptive latency. The watermark (in input frames) is raised on every underrun and lowered
+    // again when the FIFO never got close to running dry during a whole measurement window.
+    u32 m_adaptive_watermark = 0;
+    u32 m_window_frames = 0;
+    u32 m_window_min_slack = MAX_SAMPLES;
+    bool m_had_samples = false;
+    std::atomic<u32> m_buffered_frames{0};
+    std::atomic<u32> m_target_frames{0};
+    std::atomic<u64> m_underruns{0};
   };
 
   void RefreshConfig();
+  void MixAll(s32* samples, unsigned int num_samples, bool consider_framelimit);
 
   MixerFifo m_dma_mixer{this, FIXED_SAMPLE_RATE_DIVIDEND / 32000, false};
   MixerFifo m_streaming_mixer{this, FIXED_SAMPLE_RATE_DIVIDEND / 48000, false};
@@ -110,6 +147,10 @@ private:
   AudioCommon::AudioStretcher m_stretcher;
   AudioCommon::SurroundDecoder m_surround_decoder;
   std::array<short, MAX_SAMPLES * 2> m_scratch_buffer{};
+  // All FIFOs are mixed into this buffer, which is only clamped once at the end.
+  std::array<s32, MAX_SAMPLES * 2> m_accumulator{};
+  // Linear, host endian copy of the frames a FIFO is currently resampling.
+  std::array<s16, MAX_SAMPLES * 2> m_fifo_frames{};
 
   WaveFileWriter m_wave_writer_dtk;
   WaveFileWriter m_wave_writer_dsp;
@@ -123,6 +164,8 @@ private:
   float m_config_emulation_speed;
   int m_config_timing_variance;
   bool m_config_audio_stretch;
+  bool m_config_sinc_resampling;
+  bool m_config_adaptive_latency;
 
   size_t m_config_changed_callback_id;
 };
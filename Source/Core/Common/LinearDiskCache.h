@@ -5,11 +5,14 @@
 
 #include <algorithm>
 #include <cstring>
+#include <map>
 #include <memory>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
 #include "Common/IOFile.h"
 #include "Common/Version.h"
 
@@ -36,6 +39,8 @@ public:
 
 // Dead simple unsorted key-value store with append functionality.
 // No random read functionality, all reading is done in OpenAndRead.
+// If a key was appended more than once, only its most recent value is passed to the reader,
+// and the file is compacted to drop the stale values.
 // Keys and values can contain any characters, including \0.
 //
 // Suitable for caching generated shader bytecode between executions.
@@ -64,45 +69,76 @@ public:
     // try opening for reading/writing
     m_file.Open(filename, "r+b");
 
-    const u64 file_size = m_file.GetSize();
-
     m_header.Init();
     if (m_file.IsOpen() && ValidateHeader())
     {
-      // good header, read some key/value pairs
-      K key;
+      // good header, build an index of the key/value pairs without reading the values
+      std::vector<Entry> entries = ReadIndex();
+
+      // If a key was appended more than once, only the most recent value is used. The file is
+      // compacted in that case, so that the stale values aren't read again on the next run.
+      std::map<K, size_t, KeyLess> latest;
+      for (size_t i = 0; i < entries.size(); ++i)
+        latest.insert_or_assign(entries[i].key, i);
+
+      const bool compact = latest.size() != entries.size();
+      LinearDiskCache compacted;
+      const std::string compacted_filename = filename + ".compact";
+      if (compact)
+      {
+        compacted.m_header.Init();
+        compacted.m_file.Open(compacted_filename, "wb");
+        compacted.WriteHeader();
+      }
 
       std::unique_ptr<V[]> value = nullptr;
-      u32 value_size = 0;
-      u32 entry_number = 0;
-      u64 last_valid_value_start = m_file.Tell();
-
-      while (m_file.ReadArray(&value_size, 1))
+      u32 num_read = 0;
+      bool read_failed = false;
+      for (size_t i = 0; i < entries.size(); ++i)
       {
-        const u64 next_extent = m_file.Tell() + sizeof(value_size) + value_size;
-        if (next_extent > file_size)
-          break;
+        const Entry& entry = entries[i];
+        if (latest.find(entry.key)->second != i)
+          continue;
 
         // TODO: use make_unique_for_overwrite in C++20
-        value = std::unique_ptr<V[]>(new V[value_size]);
-
-        // read key/value and pass to reader
-        if (m_file.ReadArray(&key, 1) && m_file.ReadArray(value.get(), value_size) &&
-            m_file.ReadArray(&entry_number, 1) && entry_number == m_num_entries + 1)
-        {
-          last_valid_value_start = m_file.Tell();
-          reader.Read(key, value.get(), value_size);
-        }
-        else
+        value = std::unique_ptr<V[]>(new V[entry.value_size]);
+        if (!m_file.Seek(entry.value_offset, File::SeekOrigin::Begin) ||
+            !m_file.ReadArray(value.get(), entry.value_size))
         {
+          read_failed = true;
           break;
         }
 
-        m_num_entries++;
+        reader.Read(entry.key, value.get(), entry.value_size);
+        if (compact)
+          compacted.Append(entry.key, value.get(), entry.value_size);
+        num_read++;
       }
       m_file.ClearError();
-      m_file.Seek(last_valid_value_start, File::SeekOrigin::Begin);
 
+      if (compact && !read_failed && compacted.m_file)
+      {
+        compacted.Close();
+        Close();
+        if (File::Rename(compacted_filename, filename))
+        {
+          m_file.Open(filename, "r+b");
+          m_file.Seek(0, File::SeekOrigin::End);
+          m_num_entries = num_read;
+          return m_num_entries;
+        }
+
+        // Keep using the uncompacted file.
+        m_file.Open(filename, "r+b");
+      }
+      else if (compact)
+      {
+        compacted.Close();
+        File::Delete(compacted_filename);
+      }
+
+      m_num_entries = static_cast<u32>(entries.size());
+      m_file.Seek(m_end_of_valid_data, File::SeekOrigin::Begin);
       return m_num_entries;
     }
 
@@ -134,6 +170,54 @@ public:
   }
 
 private:
+  struct Entry
+  {
+    K key;
+    u64 value_offset;
+    u32 value_size;
+  };
+
+  struct KeyLess
+  {
+    bool operator()(const K& lhs, const K& rhs) const
+    {
+      return std::memcmp(&lhs, &rhs, sizeof(K)) < 0;
+    }
+  };
+
+  // Reads the keys and value locations of all valid entries, skipping over the values.
+  // Reading stops at the first truncated or corrupted entry.
+  std::vector<Entry> ReadIndex()
+  {
+    const u64 file_size = m_file.GetSize();
+    std::vector<Entry> entries;
+
+    Entry entry;
+    u32 entry_number = 0;
+    m_end_of_valid_data = m_file.Tell();
+    while (m_file.ReadArray(&entry.value_size, 1))
+    {
+      const u64 next_extent = m_file.Tell() + sizeof(entry.value_size) + entry.value_size;
+      if (next_extent > file_size)
+        break;
+
+      if (!m_file.ReadArray(&entry.key, 1))
+        break;
+      entry.value_offset = m_file.Tell();
+      if (!m_file.Seek(entry.value_size * sizeof(V), File::SeekOrigin::Current) ||
+          !m_file.ReadArray(&entry_number, 1) || entry_number != entries.size() + 1)
+      {
+        break;
+      }
+
+      m_end_of_valid_data = m_file.Tell();
+      entries.push_back(entry);
+    }
+    m_file.ClearError();
+
+    return entries;
+  }
+
   void WriteHeader() { m_file.WriteArray(&m_header, 1); }
   bool ValidateHeader()
   {
@@ -162,4 +246,5 @@ private:
 
   File::IOFile m_file;
   u32 m_num_entries = 0;
+  u64 m_end_of_valid_data = 0;
 };
@@ -113,7 +113,9 @@ static constexpr int GFX_STEREO_CONVERGENCE_MAXIMUM = 200;
 extern const Info<bool> GFX_HACK_EFB_ACCESS_ENABLE;
 extern const Info<bool> GFX_HACK_EFB_DEFER_INVALIDATION;
 extern const Info<int> GFX_HACK_EFB_ACCESS_TILE_SIZE;
+extern const Info<bool> GFX_HACK_EFB_ACCESS_PREFETCH;
 extern const Info<bool> GFX_HACK_BBOX_ENABLE;
+extern const Info<bool> GFX_HACK_BBOX_DEFER_READBACK;
 extern const Info<bool> GFX_HACK_FORCE_PROGRESSIVE;
 extern const Info<bool> GFX_HACK_SKIP_EFB_COPY_TO_RAM;
 extern const Info<bool> GFX_HACK_SKIP_XFB_COPY_TO_RAM;
@@ -64,6 +64,8 @@ bool IsSettingSaveable(const Config::Location& config_location)
       &Config::MAIN_AUDIO_LATENCY.GetLocation(),
       &Config::MAIN_AUDIO_STRETCH.GetLocation(),
       &Config::MAIN_AUDIO_STRETCH_LATENCY.GetLocation(),
+      &Config::MAIN_AUDIO_SINC_RESAMPLING.GetLocation(),
+      &Config::MAIN_AUDIO_ADAPTIVE_LATENCY.GetLocation(),
       &Config::MAIN_OVERCLOCK.GetLocation(),
       &Config::MAIN_OVERCLOCK_ENABLE.GetLocation(),
       &Config::MAIN_RAM_OVERRIDE_ENABLE.GetLocation(),
@@ -108,6 +110,7 @@ bool IsSettingSaveable(const Config::Location& config_location)
       &Config::MAIN_FAST_DISC_SPEED.GetLocation(),
       &Config::MAIN_SYNC_ON_SKIP_IDLE.GetLocation(),
       &Config::MAIN_FASTMEM.GetLocation(),
+      &Config::MAIN_FASTMEM_PAGE_TABLE.GetLocation(),
       &Config::MAIN_TIMING_VARIANCE.GetLocation(),
       &Config::MAIN_WII_SD_CARD.GetLocation(),
       &Config::MAIN_WII_SD_CARD_ENABLE_FOLDER_SYNC.GetLocation(),
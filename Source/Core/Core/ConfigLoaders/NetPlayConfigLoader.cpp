@@ -61,6 +61,8 @@ public:
 
     layer->Set(Config::GFX_HACK_EFB_ACCESS_ENABLE, m_settings.m_EFBAccessEnable);
     layer->Set(Config::GFX_HACK_BBOX_ENABLE, m_settings.m_BBoxEnable);
+    // Deferred values depend on the timing of the GPU thread, which would desync.
+    layer->Set(Config::GFX_HACK_BBOX_DEFER_READBACK, false);
     layer->Set(Config::GFX_HACK_FORCE_PROGRESSIVE, m_settings.m_ForceProgressive);
     layer->Set(Config::GFX_HACK_SKIP_EFB_COPY_TO_RAM, m_settings.m_EFBToTextureEnable);
     layer->Set(Config::GFX_HACK_SKIP_XFB_COPY_TO_RAM, m_settings.m_XFBToTextureEnable);
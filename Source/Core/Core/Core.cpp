@@ -944,6 +944,13 @@ void UpdateTitle(u64 elapsed_ms)
       SFPS += fmt::format(" | CPU: ~{} MHz [Real: {} + IdleSkip: {}] / {} MHz (~{:3.0f}%)", diff,
                           diff - idleDiff, idleDiff, SystemTimers::GetTicksPerSecond() / 1000000,
                           TicksPercentage);
+
+      if (SoundStream* sound_stream = Core::System::GetInstance().GetSoundStream())
+      {
+        const Mixer::LatencyStats audio = sound_stream->GetMixer()->GetLatencyStats();
+        SFPS += fmt::format(" | Audio: {:.0f}/{:.0f} ms buffered, {} underruns", audio.buffered_ms,
+                            audio.target_ms, audio.underruns);
+      }
     }
   }
 
@@ -17,6 +17,7 @@
 #include "Common/SPSCQueue.h"
 
 #include "Core/Config/MainSettings.h"
+#include "Core/ConfigManager.h"
 #include "Core/Core.h"
 #include "Core/PowerPC/PowerPC.h"
 
@@ -67,6 +68,15 @@ static float s_last_OC_factor;
 static constexpr int MAX_SLICE_LENGTH = 20000;
 
 static s64 s_idled_cycles;
+
+struct IdleLoopStats
+{
+  u64 count = 0;
+  s64 idled_cycles = 0;
+};
+// Keyed by the start address of the idle loop. Not saved in states, it's only used for reporting.
+static std::unordered_map<u32, IdleLoopStats> s_idle_loops;
+
 static u32 s_fake_dec_start_value;
 static u64 s_fake_dec_start_ticks;
 
@@ -136,6 +146,7 @@ void Init()
   g.slice_length = MAX_SLICE_LENGTH;
   g.global_timer = 0;
   s_idled_cycles = 0;
+  s_idle_loops.clear();
 
   // The time between CoreTiming being intialized and the first call to Advance() is considered
   // the slice boundary between slice -1 and slice 0. Dispatcher loops must call Advance() before
@@ -149,6 +160,9 @@ void Init()
 
 void Shutdown()
 {
+  if (!s_idle_loops.empty())
+    NOTICE_LOG_FMT(POWERPC, "{}", GetIdleLoopSummary());
+
   std::lock_guard lk(s_ts_write_lock);
   MoveEvents();
   ClearPendingEvents();
@@ -387,7 +401,7 @@ void AdjustEventQueueTimes(u32 new_ppc_clock, u32 old_ppc_clock)
   }
 }
 
-void Idle()
+void Idle(u32 loop_address)
 {
   if (s_config_sync_on_skip_idle)
   {
@@ -398,8 +412,16 @@ void Idle()
   }
 
   PowerPC::UpdatePerformanceMonitor(PowerPC::ppcState.downcount, 0, 0);
-  s_idled_cycles += DowncountToCycles(PowerPC::ppcState.downcount);
+  const int cycles = DowncountToCycles(PowerPC::ppcState.downcount);
+  s_idled_cycles += cycles;
   PowerPC::ppcState.downcount = 0;
+
+  if (loop_address != 0)
+  {
+    IdleLoopStats& stats = s_idle_loops[loop_address];
+    stats.count++;
+    stats.idled_cycles += cycles;
+  }
 }
 
 std::string GetScheduledEventsSummary()
@@ -416,6 +438,23 @@ std::string GetScheduledEventsSummary()
   return text;
 }
 
+std::string GetIdleLoopSummary()
+{
+  std::vector<std::pair<u32, IdleLoopStats>> loops(s_idle_loops.begin(), s_idle_loops.end());
+  std::sort(loops.begin(), loops.end(), [](const auto& a, const auto& b) {
+    return a.second.idled_cycles > b.second.idled_cycles;
+  });
+
+  const u64 ticks = std::max<u64>(GetTicks(), 1);
+  std::string text = fmt::format("Idle loops for {}\n", SConfig::GetInstance().GetGameID());
+  for (const auto& [address, stats] : loops)
+  {
+    text += fmt::format("{:08x} : {} times, {} cycles skipped ({:.2f}%)\n", address, stats.count,
+                        stats.idled_cycles, 100.0 * stats.idled_cycles / ticks);
+  }
+  return text;
+}
+
 u32 GetFakeDecStartValue()
 {
   return s_fake_dec_start_value;
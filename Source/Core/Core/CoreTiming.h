@@ -87,7 +87,8 @@ void Advance();
 void MoveEvents();
 
 // Pretend that the main CPU has executed enough cycles to reach the next event.
-void Idle();
+// loop_address is the start of the idle loop that was detected, if any, for the idle loop summary.
+void Idle(u32 loop_address = 0);
 
 // Clear all pending events. This should ONLY be done on exit or state load.
 void ClearPendingEvents();
@@ -95,6 +96,7 @@ void ClearPendingEvents();
 void LogPendingEvents();
 
 std::string GetScheduledEventsSummary();
+std::string GetIdleLoopSummary();
 
 void AdjustEventQueueTimes(u32 new_ppc_clock, u32 old_ppc_clock);
 
@@ -11,6 +11,7 @@
 #include "Common/BitSet.h"
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
+#include "Common/Hash.h"
 #include "Common/Logging/Log.h"
 
 #include "Core/DSP/DSPAnalyzer.h"
@@ -25,7 +26,14 @@ using namespace Gen;
 
 namespace DSP::JIT::x64
 {
-constexpr size_t COMPILED_CODE_SIZE = 2097152;
+constexpr size_t COMPILED_CODE_SIZE = 8388608;
+// When a new uCode is loaded and less than this is left, the code space and all cached uCodes
+// are thrown away. This is the space a single uCode could always use before uCodes were cached.
+constexpr size_t MIN_CODE_SPACE_PER_UCODE = 2097152;
+// Each cached uCode keeps a copy of IRAM and block tables for the IRAM and IROM ranges (about
+// 340 KiB). Games only switch between a handful of uCodes, so the least recently used ones are
+// dropped beyond this.
+constexpr size_t MAX_CACHED_UCODES = 4;
 constexpr size_t MAX_BLOCK_SIZE = 250;
 constexpr u16 DSP_IDLE_SKIP_CYCLES = 0x1000;
 
@@ -69,18 +77,71 @@ u16 DSPEmitter::RunCycles(u16 cycles)
 void DSPEmitter::DoState(PointerWrap& p)
 {
   p.Do(m_cycles_left);
+
+  // Loading a state replaces IRAM. Switch to the loaded uCode's blocks, so that blocks compiled
+  // from now on aren't cached under the previous uCode.
+  if (p.IsReadMode())
+  {
+    const u16* const iram = m_dsp_core.DSPState().iram;
+    if (m_iram_contents.size() != DSP_IRAM_SIZE ||
+        !std::equal(m_iram_contents.begin(), m_iram_contents.end(), iram))
+    {
+      ClearIRAM();
+    }
+  }
 }
 
 void DSPEmitter::ClearIRAM()
 {
-  for (size_t i = 0; i < DSP_IRAM_SIZE; i++)
+  // Keep the blocks of the outgoing uCode, so that they can be reused if it gets loaded again
+  // (e.g. when a game switches between its audio uCode and the card or GBA uCode). IRAM contents
+  // that never ran, such as the intermediate states of a uCode upload done in several DMAs, are
+  // not worth keeping.
+  if (m_iram_executed && !m_iram_contents.empty())
+    CacheCurrentUCode();
+
+  const u16* const iram = m_dsp_core.DSPState().iram;
+  m_iram_hash = Common::GetHash64(reinterpret_cast<const u8*>(iram), DSP_IRAM_BYTE_SIZE, 0);
+  m_iram_contents.assign(iram, iram + DSP_IRAM_SIZE);
+  m_iram_executed = false;
+
+  if (GetSpaceLeft() < MIN_CODE_SPACE_PER_UCODE)
   {
-    m_blocks[i] = (DSPCompiledCode)m_stub_entry_point;
-    m_block_links[i] = nullptr;
-    m_block_size[i] = 0;
-    m_unresolved_jumps[i].clear();
+    ResetBlocks();
+    m_dsp_core.DSPState().reset_dspjit_codespace = true;
+    return;
+  }
+
+  const auto cached = m_ucode_cache.find(m_iram_hash);
+  if (cached != m_ucode_cache.end() && cached->second.iram == m_iram_contents)
+  {
+    INFO_LOG_FMT(DSPLLE, "Reusing compiled blocks for uCode {:016x}", m_iram_hash);
+    RestoreBlocks(cached->second);
+    cached->second.last_use = ++m_ucode_cache_use_counter;
+    m_iram_executed = true;
+  }
+  else
+  {
+    ResetBlocks();
+  }
+}
+
+void DSPEmitter::CacheCurrentUCode()
+{
+  CachedUCode& cached = m_ucode_cache[m_iram_hash];
+  cached.iram = std::move(m_iram_contents);
+  cached.last_use = ++m_ucode_cache_use_counter;
+  SaveBlocks(cached);
+
+  if (m_ucode_cache.size() > MAX_CACHED_UCODES)
+  {
+    const auto least_recently_used =
+        std::min_element(m_ucode_cache.begin(), m_ucode_cache.end(),
+                         [](const auto& a, const auto& b) {
+                           return a.second.last_use < b.second.last_use;
+                         });
+    m_ucode_cache.erase(least_recently_used);
   }
-  m_dsp_core.DSPState().reset_dspjit_codespace = true;
 }
 
 void DSPEmitter::ClearIRAMandDSPJITCodespaceReset()
@@ -89,6 +150,15 @@ void DSPEmitter::ClearIRAMandDSPJITCodespaceReset()
   CompileDispatcher();
   m_stub_entry_point = CompileStub();
 
+  m_ucode_cache.clear();
+  m_iram_executed = false;
+  ResetBlocks();
+  m_dsp_core.DSPState().reset_dspjit_codespace = false;
+}
+
+void DSPEmitter::ResetBlocks()
+{
+  // Blocks can link to each other, so all of them need to be reset, not just the IRAM ones.
   for (size_t i = 0; i < MAX_BLOCKS; i++)
   {
     m_blocks[i] = (DSPCompiledCode)m_stub_entry_point;
@@ -96,7 +166,41 @@ void DSPEmitter::ClearIRAMandDSPJITCodespaceReset()
     m_block_size[i] = 0;
     m_unresolved_jumps[i].clear();
   }
-  m_dsp_core.DSPState().reset_dspjit_codespace = false;
+}
+
+static constexpr std::array<u16, 2> EXECUTABLE_RANGES{0x0000, 0x8000};
+
+void DSPEmitter::SaveBlocks(CachedUCode& ucode) const
+{
+  ucode.blocks.clear();
+  ucode.block_size.clear();
+  ucode.block_links.clear();
+  ucode.unresolved_jumps.clear();
+
+  for (const u16 start : EXECUTABLE_RANGES)
+  {
+    const size_t end = start + DSP_IRAM_SIZE;
+    ucode.blocks.insert(ucode.blocks.end(), &m_blocks[start], &m_blocks[end]);
+    ucode.block_size.insert(ucode.block_size.end(), &m_block_size[start], &m_block_size[end]);
+    ucode.block_links.insert(ucode.block_links.end(), &m_block_links[start], &m_block_links[end]);
+    ucode.unresolved_jumps.insert(ucode.unresolved_jumps.end(), &m_unresolved_jumps[start],
+                                  &m_unresolved_jumps[end]);
+  }
+}
+
+void DSPEmitter::RestoreBlocks(const CachedUCode& ucode)
+{
+  ResetBlocks();
+
+  size_t index = 0;
+  for (const u16 start : EXECUTABLE_RANGES)
+  {
+    std::copy_n(&ucode.blocks[index], DSP_IRAM_SIZE, &m_blocks[start]);
+    std::copy_n(&ucode.block_size[index], DSP_IRAM_SIZE, &m_block_size[start]);
+    std::copy_n(&ucode.block_links[index], DSP_IRAM_SIZE, &m_block_links[start]);
+    std::copy_n(&ucode.unresolved_jumps[index], DSP_IRAM_SIZE, &m_unresolved_jumps[start]);
+    index += DSP_IRAM_SIZE;
+  }
 }
 
 static void CheckExceptionsThunk(DSPCore& dsp)
@@ -228,6 +332,8 @@ void DSPEmitter::Compile(u16 start_addr)
 {
   // Remember the current block address for later
   m_start_address = start_addr;
+  if (start_addr < DSP_IRAM_SIZE)
+    m_iram_executed = true;
   m_unresolved_jumps[start_addr].clear();
 
   const u8* entryPoint = AlignCode16();
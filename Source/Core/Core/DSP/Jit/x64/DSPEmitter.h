@@ -6,6 +6,7 @@
 #include <array>
 #include <cstddef>
 #include <list>
+#include <unordered_map>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -200,8 +201,24 @@ private:
   static u16 ReadIFXRegisterHelper(DSPEmitter& emitter, u16 address);
   static void WriteIFXRegisterHelper(DSPEmitter& emitter, u16 address, u16 value);
 
+  // Compiled blocks of a previously loaded uCode. Only the IRAM and IROM ranges are kept,
+  // since code can't be executed from anywhere else.
+  struct CachedUCode
+  {
+    std::vector<u16> iram;
+    std::vector<DSPCompiledCode> blocks;
+    std::vector<u16> block_size;
+    std::vector<Block> block_links;
+    std::vector<std::list<u16>> unresolved_jumps;
+    u64 last_use = 0;
+  };
+
   void EmitInstruction(UDSPInstruction inst);
   void ClearIRAMandDSPJITCodespaceReset();
+  void ResetBlocks();
+  void CacheCurrentUCode();
+  void SaveBlocks(CachedUCode& ucode) const;
+  void RestoreBlocks(const CachedUCode& ucode);
 
   void CompileDispatcher();
   Block CompileStub();
@@ -213,6 +230,7 @@ private:
 
   void WriteBranchExit();
   void WriteBlockLink(u16 dest);
+  void WriteLinkJump(const u8* dest_entry, u16 dest_size);
 
   void ReJitConditional(UDSPInstruction opc, void (DSPEmitter::*conditional_fn)(UDSPInstruction));
   void r_jcc(UDSPInstruction opc);
@@ -323,6 +341,16 @@ private:
 
   std::array<std::list<u16>, MAX_BLOCKS> m_unresolved_jumps;
 
+  // Blocks of uCodes that were loaded before, keyed by a hash of the IRAM contents they were
+  // compiled for. They stay valid until the code space is reset.
+  std::unordered_map<u64, CachedUCode> m_ucode_cache;
+  u64 m_ucode_cache_use_counter = 0;
+  // IRAM contents (and their hash) that the current blocks are compiled for, and whether any code
+  // in IRAM has run since they were loaded.
+  std::vector<u16> m_iram_contents;
+  u64 m_iram_hash = 0;
+  bool m_iram_executed = false;
+
   u16 m_cycles_left = 0;
 
   // The index of the last stored ext value (compile time).
@@ -114,24 +114,39 @@ void DSPEmitter::WriteBranchExit()
   m_gpr.FlushRegs(c, false);
 }
 
+void DSPEmitter::WriteLinkJump(const u8* dest_entry, u16 dest_size)
+{
+  m_gpr.FlushRegs();
+  // Check if we have enough cycles to execute the next block
+  MOV(64, R(RAX), ImmPtr(&m_cycles_left));
+  MOV(16, R(ECX), MatR(RAX));
+  CMP(16, R(ECX), Imm16(m_block_size[m_start_address] + dest_size));
+  FixupBranch notEnoughCycles = J_CC(CC_BE);
+
+  SUB(16, R(ECX), Imm16(m_block_size[m_start_address]));
+  MOV(16, MatR(RAX), R(ECX));
+  JMP(dest_entry, true);
+  SetJumpTarget(notEnoughCycles);
+}
+
 void DSPEmitter::WriteBlockLink(u16 dest)
 {
+  // Loops back to the start of the current block (like mailbox polling loops) jump straight to
+  // the block entry instead of going through the dispatcher, so the statically allocated
+  // registers stay loaded. Idle skip blocks still have to return their skipped cycles.
+  if (dest == m_start_address)
+  {
+    if (!m_dsp_core.DSPState().GetAnalyzer().IsIdleSkip(m_start_address))
+      WriteLinkJump(m_block_link_entry, m_block_size[m_start_address]);
+    return;
+  }
+
   // Jump directly to the called block if it has already been compiled.
   if (!(dest >= m_start_address && dest <= m_compile_pc))
   {
     if (m_block_links[dest] != nullptr)
     {
-      m_gpr.FlushRegs();
-      // Check if we have enough cycles to execute the next block
-      MOV(64, R(RAX), ImmPtr(&m_cycles_left));
-      MOV(16, R(ECX), MatR(RAX));
-      CMP(16, R(ECX), Imm16(m_block_size[m_start_address] + m_block_size[dest]));
-      FixupBranch notEnoughCycles = J_CC(CC_BE);
-
-      SUB(16, R(ECX), Imm16(m_block_size[m_start_address]));
-      MOV(16, MatR(RAX), R(ECX));
-      JMP(m_block_links[dest], true);
-      SetJumpTarget(notEnoughCycles);
+      WriteLinkJump(m_block_links[dest], m_block_size[dest]);
     }
     else
     {
@@ -147,8 +162,8 @@ void DSPEmitter::r_jcc(const UDSPInstruction opc)
   const u16 dest = m_dsp_core.DSPState().ReadIMEM(m_compile_pc + 1);
   const DSPOPCTemplate* opcode = GetOpTemplate(opc);
 
-  // If the block is unconditional, attempt to link block
-  if (opcode->uncond_branch)
+  // If the block is unconditional or loops back to itself, attempt to link block
+  if (opcode->uncond_branch || dest == m_start_address)
     WriteBlockLink(dest);
   MOV(16, M_SDSP_pc(), Imm16(dest));
   WriteBranchExit();
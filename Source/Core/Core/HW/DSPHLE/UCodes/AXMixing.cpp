@@ -0,0 +1,315 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Core/HW/DSPHLE/UCodes/AXMixing.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#include "Common/CommonTypes.h"
+#include "Common/Intrinsics.h"
+#include "Common/MathUtil.h"
+#include "Core/HW/DSPHLE/UCodes/AXStructs.h"
+
+#ifdef _M_ARM_64
+#include <arm_neon.h>
+#endif
+
+namespace DSP::HLE
+{
+namespace
+{
+// Maximum number of input samples that can be fetched ahead of time by the batched
+// resampler. Anything requiring more than this (ratios above ~20x for AX Wii)
+// goes through the per-sample path instead.
+constexpr u32 MAX_BATCHED_INPUT_SAMPLES = 2048;
+
+s16 ScaleSample(s16 sample, u16 volume)
+{
+  const s32 scaled = (s32(sample) * volume) >> 15;
+  return static_cast<s16>(std::clamp(scaled, -32767, 32767));  // -32768 ?
+}
+
+#if defined(_M_X86)
+// Computes (samples * volumes) >> 15 for 8 samples, saturated to [-32767, 32767].
+// The volumes are unsigned, so the signed 16x16 multiplication is corrected by adding
+// sample << 16 for every volume that has its top bit set.
+__m128i ScaleSamples(__m128i samples, __m128i volumes)
+{
+  const __m128i lo = _mm_mullo_epi16(samples, volumes);
+  const __m128i hi = _mm_mulhi_epi16(samples, volumes);
+  const __m128i correction = _mm_and_si128(samples, _mm_srai_epi16(volumes, 15));
+
+  __m128i prod_lo = _mm_unpacklo_epi16(lo, hi);
+  __m128i prod_hi = _mm_unpackhi_epi16(lo, hi);
+  prod_lo = _mm_add_epi32(prod_lo, _mm_unpacklo_epi16(_mm_setzero_si128(), correction));
+  prod_hi = _mm_add_epi32(prod_hi, _mm_unpackhi_epi16(_mm_setzero_si128(), correction));
+
+  const __m128i packed = _mm_packs_epi32(_mm_srai_epi32(prod_lo, 15), _mm_srai_epi32(prod_hi, 15));
+  return _mm_max_epi16(packed, _mm_set1_epi16(-32767));
+}
+
+// Volumes for the next 8 samples of a ramp starting at <volume>.
+__m128i RampVolumes(u16 volume, u16 volume_delta)
+{
+  const __m128i steps = _mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7);
+  return _mm_add_epi16(_mm_set1_epi16(static_cast<s16>(volume)),
+                       _mm_mullo_epi16(_mm_set1_epi16(static_cast<s16>(volume_delta)), steps));
+}
+#elif defined(_M_ARM_64)
+int16x8_t ScaleSamples(int16x8_t samples, uint16x8_t volumes)
+{
+  const int32x4_t lo = vmulq_s32(vmovl_s16(vget_low_s16(samples)),
+                                 vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(volumes))));
+  const int32x4_t hi = vmulq_s32(vmovl_s16(vget_high_s16(samples)),
+                                 vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(volumes))));
+  const int16x8_t packed =
+      vcombine_s16(vqmovn_s32(vshrq_n_s32(lo, 15)), vqmovn_s32(vshrq_n_s32(hi, 15)));
+  return vmaxq_s16(packed, vdupq_n_s16(-32767));
+}
+
+uint16x8_t RampVolumes(u16 volume, u16 volume_delta)
+{
+  static constexpr u16 steps_array[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+  return vmlaq_u16(vdupq_n_u16(volume), vld1q_u16(steps_array), vdupq_n_u16(volume_delta));
+}
+#endif
+
+// Original per-sample resampler, used when the batched path can't prefetch all inputs.
+u32 ResampleAudioPerSample(const std::function<s16(u32)>& input_callback, s16* output, u32 count,
+                           s16* last_samples, u32 curr_pos, u32 ratio, bool polyphase,
+                           const s16* coeffs)
+{
+  int read_samples_count = 0;
+
+  // This is the circular buffer containing samples to use for the
+  // interpolation. It is initialized with the values from the PB, and it
+  // will be stored back to the PB at the end.
+  s16 temp[4];
+  u32 idx = 0;
+
+  temp[idx++ & 3] = last_samples[0];
+  temp[idx++ & 3] = last_samples[1];
+  temp[idx++ & 3] = last_samples[2];
+  temp[idx++ & 3] = last_samples[3];
+
+  for (u32 i = 0; i < count; ++i)
+  {
+    curr_pos += ratio;
+
+    // While our current position is >= 1.0, push new samples to the
+    // circular buffer.
+    while (curr_pos >= 0x10000)
+    {
+      temp[idx++ & 3] = input_callback(read_samples_count++);
+      curr_pos -= 0x10000;
+    }
+
+    if (polyphase)
+    {
+      u16 curr_pos_frac = ((curr_pos & 0xFFFF) >> 9) << 2;
+      const s16* c = &coeffs[curr_pos_frac];
+
+      s64 t0 = temp[idx++ & 3];
+      s64 t1 = temp[idx++ & 3];
+      s64 t2 = temp[idx++ & 3];
+      s64 t3 = temp[idx++ & 3];
+
+      s64 samp = (t0 * c[0] + t1 * c[1] + t2 * c[2] + t3 * c[3]) >> 15;
+
+      output[i] = MathUtil::SaturatingCast<s16>(samp);
+      continue;
+    }
+
+    // Get our current fractional position, used to know how much of
+    // curr0 and how much of curr1 the output sample should be.
+    u16 curr_frac = curr_pos & 0xFFFF;
+    u16 inv_curr_frac = -curr_frac;
+
+    // Interpolate! If curr_frac is 0, we can simply take the last
+    // sample without any multiplying.
+    s16 sample;
+    if (curr_frac)
+    {
+      s32 s0 = temp[idx++ & 3];
+      s32 s1 = temp[idx++ & 3];
+
+      sample = ((s0 * inv_curr_frac) + (s1 * curr_frac)) >> 16;
+      idx += 2;
+    }
+    else
+    {
+      sample = temp[idx++ & 3];
+      idx += 3;
+    }
+
+    output[i] = sample;
+  }
+
+  // Update the four last_samples values.
+  last_samples[3] = temp[--idx & 3];
+  last_samples[2] = temp[--idx & 3];
+  last_samples[1] = temp[--idx & 3];
+  last_samples[0] = temp[--idx & 3];
+
+  return curr_pos;
+}
+
+// Batched resampler. All input samples required for the frame are fetched up front into a
+// linear history buffer (in the same order as the per-sample path), after which every output
+// sample only depends on its absolute position in that buffer. This removes the circular buffer
+// bookkeeping and the data dependency between consecutive output samples from the inner loops.
+u32 ResampleAudioBatched(const std::function<s16(u32)>& input_callback, s16* output, u32 count,
+                         s16* last_samples, u32 curr_pos, u32 ratio, bool polyphase,
+                         const s16* coeffs, u32 input_count)
+{
+  std::array<s16, 4 + MAX_BATCHED_INPUT_SAMPLES> history;
+  std::copy_n(last_samples, 4, history.begin());
+  for (u32 i = 0; i < input_count; ++i)
+    history[4 + i] = input_callback(i);
+
+  u64 pos = curr_pos;
+  if (polyphase)
+  {
+    for (u32 i = 0; i < count; ++i)
+    {
+      pos += ratio;
+      const s16* t = &history[pos >> 16];
+      const s16* c = &coeffs[((pos & 0xFFFF) >> 9) << 2];
+
+      const s64 t0 = t[0];
+      const s64 t1 = t[1];
+      const s64 t2 = t[2];
+      const s64 t3 = t[3];
+
+      const s64 samp = (t0 * c[0] + t1 * c[1] + t2 * c[2] + t3 * c[3]) >> 15;
+      output[i] = MathUtil::SaturatingCast<s16>(samp);
+    }
+  }
+  else
+  {
+    for (u32 i = 0; i < count; ++i)
+    {
+      pos += ratio;
+      const s16* t = &history[pos >> 16];
+      const u32 curr_frac = pos & 0xFFFF;
+
+      // If curr_frac is 0, this simply returns t[0].
+      const s32 s0 = t[0];
+      const s32 s1 = t[1];
+      output[i] = static_cast<s16>((s0 * s32(0x10000 - curr_frac) + s1 * s32(curr_frac)) >> 16);
+    }
+  }
+
+  std::copy_n(&history[input_count], 4, last_samples);
+  return static_cast<u32>(pos & 0xFFFF);
+}
+}  // namespace
+
+void ApplyVolumeRamp(s16* samples, u32 count, u16& volume, u16 volume_delta)
+{
+  u32 i = 0;
+
+#if defined(_M_X86)
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&samples[i]));
+    const __m128i scaled = ScaleSamples(input, RampVolumes(volume, volume_delta));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&samples[i]), scaled);
+    volume += volume_delta * 8;
+  }
+#elif defined(_M_ARM_64)
+  for (; i + 8 <= count; i += 8)
+  {
+    const int16x8_t scaled =
+        ScaleSamples(vld1q_s16(&samples[i]), RampVolumes(volume, volume_delta));
+    vst1q_s16(&samples[i], scaled);
+    volume += volume_delta * 8;
+  }
+#endif
+
+  for (; i < count; ++i)
+  {
+    samples[i] = ScaleSample(samples[i], volume);
+    volume += volume_delta;
+  }
+}
+
+void MixAddRamped(int* out, const s16* input, u32 count, u16& volume, u16 volume_delta,
+                  s16* last_sample)
+{
+  if (count == 0)
+    return;
+
+  u32 i = 0;
+
+#if defined(_M_X86)
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&input[i]));
+    const __m128i scaled = ScaleSamples(samples, RampVolumes(volume, volume_delta));
+
+    // Sign extend to 32 bits and accumulate.
+    __m128i* dst = reinterpret_cast<__m128i*>(&out[i]);
+    const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(scaled, scaled), 16);
+    const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(scaled, scaled), 16);
+    _mm_storeu_si128(dst, _mm_add_epi32(_mm_loadu_si128(dst), lo));
+    _mm_storeu_si128(dst + 1, _mm_add_epi32(_mm_loadu_si128(dst + 1), hi));
+
+    volume += volume_delta * 8;
+    *last_sample = static_cast<s16>(_mm_extract_epi16(scaled, 7));
+  }
+#elif defined(_M_ARM_64)
+  for (; i + 8 <= count; i += 8)
+  {
+    const int16x8_t scaled =
+        ScaleSamples(vld1q_s16(&input[i]), RampVolumes(volume, volume_delta));
+
+    vst1q_s32(&out[i], vaddw_s16(vld1q_s32(&out[i]), vget_low_s16(scaled)));
+    vst1q_s32(&out[i + 4], vaddw_s16(vld1q_s32(&out[i + 4]), vget_high_s16(scaled)));
+
+    volume += volume_delta * 8;
+    *last_sample = vgetq_lane_s16(scaled, 7);
+  }
+#endif
+
+  for (; i < count; ++i)
+  {
+    const s16 sample = ScaleSample(input[i], volume);
+    out[i] += sample;
+    volume += volume_delta;
+    *last_sample = sample;
+  }
+}
+
+u32 ResampleAudio(const std::function<s16(u32)>& input_callback, s16* output, u32 count,
+                  s16* last_samples, u32 curr_pos, u32 ratio, int srctype, const s16* coeffs)
+{
+  // If DSP DROM coefficients are available, support polyphase resampling.
+  const bool polyphase = coeffs && srctype == SRCTYPE_POLYPHASE;
+
+  if (polyphase || srctype == SRCTYPE_LINEAR || srctype == SRCTYPE_POLYPHASE)
+  {
+    // The per-sample path advances a 32-bit position, so only batch when that can't overflow.
+    const u64 input_count = (u64(curr_pos) + u64(count) * ratio) >> 16;
+    if (curr_pos < 0x10000 && input_count <= MAX_BATCHED_INPUT_SAMPLES)
+    {
+      return ResampleAudioBatched(input_callback, output, count, last_samples, curr_pos, ratio,
+                                  polyphase, coeffs, static_cast<u32>(input_count));
+    }
+    return ResampleAudioPerSample(input_callback, output, count, last_samples, curr_pos, ratio,
+                                  polyphase, coeffs);
+  }
+
+  // SRCTYPE_NEAREST
+  // No sample rate conversion here: simply read samples from the
+  // accelerator to the output buffer.
+  for (u32 i = 0; i < count; ++i)
+    output[i] = input_callback(i);
+
+  memcpy(last_samples, output + count - 4, 4 * sizeof(u16));
+
+  return curr_pos;
+}
+}  // namespace DSP::HLE
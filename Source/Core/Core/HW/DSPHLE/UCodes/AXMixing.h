@@ -0,0 +1,49 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Version independent sample processing kernels shared by AX GC and AX Wii.
+// The results of these functions are bit-exact with the original per-sample
+// implementations, regardless of whether a SIMD path is used or not.
+
+#pragma once
+
+#include <functional>
+
+#include "Common/CommonTypes.h"
+
+namespace DSP::HLE
+{
+// Multiplies <count> samples in place by a 1.15 fixed point volume, saturating
+// the results to [-32767, 32767]. <volume> is incremented by <volume_delta>
+// (with 16-bit wraparound) after each sample and holds the final volume on return.
+void ApplyVolumeRamp(s16* samples, u32 count, u16& volume, u16 volume_delta);
+
+// Same as ApplyVolumeRamp, but adds the scaled samples to <out> instead of
+// writing them back. The last scaled sample is stored in <last_sample>
+// (used for the DPOP roll-off) if <count> is not 0.
+void MixAddRamped(int* out, const s16* input, u32 count, u16& volume, u16 volume_delta,
+                  s16* last_sample);
+
+// Reads samples from the input callback, resamples them to <count> samples at
+// the wanted sample rate (computed from the ratio, see below).
+//
+// If srctype is SRCTYPE_POLYPHASE, coefficients need to be provided as well
+// (or the srctype will automatically be changed to LINEAR).
+//
+// Returns the current position after resampling (including fractional part).
+//
+// The input to output ratio is set in <ratio>, which is a floating point num
+// stored as a 32b integer:
+//  * Upper 16 bits of the ratio are the integer part
+//  * Lower 16 bits are the decimal part
+//
+// <curr_pos> is a 32b integer structured in the same way as the ratio: the
+// upper 16 bits are the integer part of the current position in the input
+// stream, and the lower 16 bits are the decimal part.
+//
+// We start getting samples not from sample 0, but 0.<curr_pos_frac>. This
+// avoids discontinuities in the audio stream, especially with very low ratios
+// which interpolate a lot of values between two "real" samples.
+u32 ResampleAudio(const std::function<s16(u32)>& input_callback, s16* output, u32 count,
+                  s16* last_samples, u32 curr_pos, u32 ratio, int srctype, const s16* coeffs);
+}  // namespace DSP::HLE
@@ -11,9 +11,14 @@
 #include <algorithm>
 #include <array>
 #include <cstring>
+#include <map>
 #include <memory>
 #include <tuple>
 
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
@@ -50,6 +55,7 @@ u8* logical_base = nullptr;
 u8* physical_page_mappings_base = nullptr;
 u8* logical_page_mappings_base = nullptr;
 static bool is_fastmem_arena_initialized = false;
+static bool s_page_table_mappings_enabled = false;
 
 // The MemArena class
 static Common::MemArena g_arena;
@@ -225,6 +231,10 @@ static std::array<PhysicalMemoryRegion, 4> s_physical_regions;
 
 static std::vector<LogicalMemoryView> logical_mapped_entries;
 
+// Single pages mapped into the logical fastmem region from the page table, keyed by
+// (TLB index << 32 | logical address) so that a tlbie can drop the pages it could affect.
+static std::map<u64, LogicalMemoryView> s_page_table_mapped_entries;
+
 static std::array<void*, PowerPC::BAT_PAGE_COUNT> s_physical_page_mappings;
 static std::array<void*, PowerPC::BAT_PAGE_COUNT> s_logical_page_mappings;
 
@@ -355,6 +365,13 @@ bool InitFastmemArena()
 
 #ifndef _ARCH_32
   logical_base = physical_base + 0x200000000;
+
+#ifndef _WIN32
+  // Page table translations are mapped one 4 KiB page at a time, which needs the host to use
+  // the same page size. Windows can only map views at 64 KiB granularity.
+  s_page_table_mappings_enabled = Config::Get(Config::MAIN_FASTMEM_PAGE_TABLE) &&
+                                  sysconf(_SC_PAGESIZE) == PowerPC::HW_PAGE_SIZE;
+#endif
 #endif
 
   is_fastmem_arena_initialized = true;
@@ -363,6 +380,10 @@ bool InitFastmemArena()
 
 void UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
 {
+  // Page table mappings may overlap the new BAT mappings. They are recreated by the next page
+  // table walk for each page.
+  ClearPageTableMappings();
+
   for (auto& entry : logical_mapped_entries)
   {
     g_arena.UnmapFromMemoryRegion(entry.mapped_pointer, entry.mapped_size);
@@ -418,6 +439,76 @@ void UpdateLogicalMemory(const PowerPC::BatTable& dbat_table)
   }
 }
 
+bool IsPageTableFastmemEnabled()
+{
+  return is_fastmem_arena_initialized && s_page_table_mappings_enabled;
+}
+
+void AddPageTableMapping(u32 logical_address, u32 translated_address, u32 tlb_index)
+{
+  if (!IsPageTableFastmemEnabled())
+    return;
+
+  const u64 key = (u64(tlb_index) << 32) | logical_address;
+  if (s_page_table_mapped_entries.count(key) != 0)
+    return;
+
+  for (const auto& physical_region : s_physical_regions)
+  {
+    if (!physical_region.active)
+      continue;
+
+    const u32 mapping_address = physical_region.physical_address;
+    if (translated_address < mapping_address ||
+        translated_address - mapping_address >= physical_region.size)
+    {
+      continue;
+    }
+
+    const u32 position = physical_region.shm_position + translated_address - mapping_address;
+    u8* base = logical_base + logical_address;
+    void* mapped_pointer = g_arena.MapInMemoryRegion(position, PowerPC::HW_PAGE_SIZE, base);
+    // Unlike the BAT mappings this is only an optimization, so a failure just leaves the page on
+    // the slow path.
+    if (mapped_pointer)
+    {
+      s_page_table_mapped_entries.emplace(
+          key, LogicalMemoryView{mapped_pointer, static_cast<u32>(PowerPC::HW_PAGE_SIZE)});
+    }
+    return;
+  }
+}
+
+void RemovePageTableMappings(u32 tlb_index)
+{
+  const auto begin = s_page_table_mapped_entries.lower_bound(u64(tlb_index) << 32);
+  const auto end = s_page_table_mapped_entries.lower_bound(u64(tlb_index + 1) << 32);
+  for (auto it = begin; it != end; ++it)
+    g_arena.UnmapFromMemoryRegion(it->second.mapped_pointer, it->second.mapped_size);
+  s_page_table_mapped_entries.erase(begin, end);
+}
+
+void RemovePageTableMappings(u32 logical_address, u32 size)
+{
+  const u64 end_address = u64(logical_address) + size;
+  for (u32 tlb_index = 0; tlb_index <= PowerPC::HW_PAGE_INDEX_MASK; ++tlb_index)
+  {
+    const u64 tlb_key = u64(tlb_index) << 32;
+    const auto begin = s_page_table_mapped_entries.lower_bound(tlb_key | logical_address);
+    const auto end = s_page_table_mapped_entries.lower_bound(tlb_key + end_address);
+    for (auto it = begin; it != end; ++it)
+      g_arena.UnmapFromMemoryRegion(it->second.mapped_pointer, it->second.mapped_size);
+    s_page_table_mapped_entries.erase(begin, end);
+  }
+}
+
+void ClearPageTableMappings()
+{
+  for (auto& entry : s_page_table_mapped_entries)
+    g_arena.UnmapFromMemoryRegion(entry.second.mapped_pointer, entry.second.mapped_size);
+  s_page_table_mapped_entries.clear();
+}
+
 void DoState(PointerWrap& p)
 {
   const u32 current_ram_size = GetRamSize();
@@ -465,6 +556,11 @@ void DoState(PointerWrap& p)
   if (current_have_exram)
     p.DoArray(m_pEXRAM, current_exram_size);
   p.DoMarker("Memory EXRAM");
+
+  // The page table in RAM may have changed under the existing mappings. They are recreated on
+  // the next page table walk.
+  if (p.IsReadMode())
+    ClearPageTableMappings();
 }
 
 void Shutdown()
@@ -505,12 +601,15 @@ void ShutdownFastmemArena()
   }
   logical_mapped_entries.clear();
 
+  ClearPageTableMappings();
+
   g_arena.ReleaseMemoryRegion();
 
   physical_base = nullptr;
   logical_base = nullptr;
 
   is_fastmem_arena_initialized = false;
+  s_page_table_mappings_enabled = false;
 }
 
 void Clear()
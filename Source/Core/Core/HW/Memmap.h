@@ -70,6 +70,14 @@ void DoState(PointerWrap& p);
 
 void UpdateLogicalMemory(const PowerPC::BatTable& dbat_table);
 
+// Maps single page table translations into the logical fastmem region. Mappings are grouped by
+// the TLB index of their address so that a tlbie only has to drop the pages it could affect.
+bool IsPageTableFastmemEnabled();
+void AddPageTableMapping(u32 logical_address, u32 translated_address, u32 tlb_index);
+void RemovePageTableMappings(u32 tlb_index);
+void RemovePageTableMappings(u32 logical_address, u32 size);
+void ClearPageTableMappings();
+
 void Clear();
 
 // Routines to access physically addressed memory, designed for use by
@@ -5,6 +5,7 @@
 
 #include "Common/CommonTypes.h"
 #include "Common/Logging/Log.h"
+#include "Common/Timer.h"
 #include "Core/ConfigManager.h"
 #include "Core/CoreTiming.h"
 #include "Core/HLE/HLE.h"
@@ -207,7 +208,7 @@ static bool CheckIdle(u32 idle_pc)
 {
   if (PowerPC::ppcState.npc == idle_pc)
   {
-    CoreTiming::Idle();
+    CoreTiming::Idle(idle_pc);
   }
   return false;
 }
@@ -229,12 +230,17 @@ bool CachedInterpreter::HandleFunctionHooking(u32 address)
 
 void CachedInterpreter::Jit(u32 address)
 {
-  if (m_code.size() >= CODE_SIZE / sizeof(Instruction) - 0x1000 ||
-      SConfig::GetInstance().bJITNoBlockCache)
+  if (m_code.size() >= CODE_SIZE / sizeof(Instruction) - 0x1000)
+  {
+    ++m_compile_stats.code_space_flushes;
+    ClearCache();
+  }
+  else if (SConfig::GetInstance().bJITNoBlockCache)
   {
     ClearCache();
   }
 
+  const u64 compile_start_us = Common::Timer::NowUs();
   const u32 nextPC = analyzer.Analyze(PC, &code_block, &m_code_buffer, m_code_buffer.size());
   if (code_block.m_memory_exception)
   {
@@ -300,7 +306,7 @@ void CachedInterpreter::Jit(u32 address)
       if (check_program_exception)
         m_code.emplace_back(CheckProgramException, js.downcountAmount);
       if (idle_loop)
-        m_code.emplace_back(CheckIdle, js.blockStart);
+        m_code.emplace_back(CheckIdle, op.branchTo);
       if (endblock)
       {
         m_code.emplace_back(EndBlock, js.downcountAmount);
@@ -322,10 +328,14 @@ void CachedInterpreter::Jit(u32 address)
   b->originalSize = code_block.m_num_instructions;
 
   m_block_cache.FinalizeBlock(*b, jo.enableBlocklink, code_block.m_physical_addresses);
+
+  RecordCompiledBlock(Common::Timer::NowUs() - compile_start_us, code_block.m_num_instructions,
+                      b->codeSize, 0);
 }
 
 void CachedInterpreter::ClearCache()
 {
+  ++m_compile_stats.cache_clears;
   m_code.clear();
   m_block_cache.Clear();
   UpdateMemoryAndExceptionOptions();
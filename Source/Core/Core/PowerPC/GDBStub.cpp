@@ -629,7 +629,7 @@ static void WriteRegister()
   }
   else if (id >= 71 && id < 87)
   {
-    PowerPC::ppcState.sr[id - 71] = re32hex(bufptr);
+    PowerPC::ppcState.SetSR(id - 71, re32hex(bufptr));
   }
   else if (id >= 88 && id < 104)
   {
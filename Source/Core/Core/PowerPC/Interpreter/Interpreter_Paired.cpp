@@ -8,6 +8,7 @@
 #include "Common/CommonTypes.h"
 #include "Common/FloatUtils.h"
 #include "Core/PowerPC/Interpreter/Interpreter_FPUtils.h"
+#include "Core/PowerPC/Interpreter/Interpreter_PairedUtils.h"
 #include "Core/PowerPC/PowerPC.h"
 
 // These "binary instructions" do not alter FPSCR.
@@ -113,11 +114,11 @@ void Interpreter::ps_div(UGeckoInstruction inst)
   const auto& a = rPS(inst.FA);
   const auto& b = rPS(inst.FB);
 
-  const float ps0 = ForceSingle(FPSCR, NI_div(&FPSCR, a.PS0AsDouble(), b.PS0AsDouble()).value);
-  const float ps1 = ForceSingle(FPSCR, NI_div(&FPSCR, a.PS1AsDouble(), b.PS1AsDouble()).value);
+  const PairedResult result =
+      PairedDiv(&FPSCR, a.PS0AsDouble(), a.PS1AsDouble(), b.PS0AsDouble(), b.PS1AsDouble());
 
-  rPS(inst.FD).SetBoth(ps0, ps1);
-  PowerPC::UpdateFPRFSingle(ps0);
+  rPS(inst.FD).SetBoth(result.ps0, result.ps1);
+  PowerPC::UpdateFPRFSingle(result.ps0);
 
   if (inst.Rc)
     PowerPC::ppcState.UpdateCR1();
@@ -189,11 +190,11 @@ void Interpreter::ps_sub(UGeckoInstruction inst)
   const auto& a = rPS(inst.FA);
   const auto& b = rPS(inst.FB);
 
-  const float ps0 = ForceSingle(FPSCR, NI_sub(&FPSCR, a.PS0AsDouble(), b.PS0AsDouble()).value);
-  const float ps1 = ForceSingle(FPSCR, NI_sub(&FPSCR, a.PS1AsDouble(), b.PS1AsDouble()).value);
+  const PairedResult result =
+      PairedSub(&FPSCR, a.PS0AsDouble(), a.PS1AsDouble(), b.PS0AsDouble(), b.PS1AsDouble());
 
-  rPS(inst.FD).SetBoth(ps0, ps1);
-  PowerPC::UpdateFPRFSingle(ps0);
+  rPS(inst.FD).SetBoth(result.ps0, result.ps1);
+  PowerPC::UpdateFPRFSingle(result.ps0);
 
   if (inst.Rc)
     PowerPC::ppcState.UpdateCR1();
@@ -204,11 +205,11 @@ void Interpreter::ps_add(UGeckoInstruction inst)
   const auto& a = rPS(inst.FA);
   const auto& b = rPS(inst.FB);
 
-  const float ps0 = ForceSingle(FPSCR, NI_add(&FPSCR, a.PS0AsDouble(), b.PS0AsDouble()).value);
-  const float ps1 = ForceSingle(FPSCR, NI_add(&FPSCR, a.PS1AsDouble(), b.PS1AsDouble()).value);
+  const PairedResult result =
+      PairedAdd(&FPSCR, a.PS0AsDouble(), a.PS1AsDouble(), b.PS0AsDouble(), b.PS1AsDouble());
 
-  rPS(inst.FD).SetBoth(ps0, ps1);
-  PowerPC::UpdateFPRFSingle(ps0);
+  rPS(inst.FD).SetBoth(result.ps0, result.ps1);
+  PowerPC::UpdateFPRFSingle(result.ps0);
 
   if (inst.Rc)
     PowerPC::ppcState.UpdateCR1();
@@ -222,11 +223,10 @@ void Interpreter::ps_mul(UGeckoInstruction inst)
   const double c0 = Force25Bit(c.PS0AsDouble());
   const double c1 = Force25Bit(c.PS1AsDouble());
 
-  const float ps0 = ForceSingle(FPSCR, NI_mul(&FPSCR, a.PS0AsDouble(), c0).value);
-  const float ps1 = ForceSingle(FPSCR, NI_mul(&FPSCR, a.PS1AsDouble(), c1).value);
+  const PairedResult result = PairedMul(&FPSCR, a.PS0AsDouble(), a.PS1AsDouble(), c0, c1);
 
-  rPS(inst.FD).SetBoth(ps0, ps1);
-  PowerPC::UpdateFPRFSingle(ps0);
+  rPS(inst.FD).SetBoth(result.ps0, result.ps1);
+  PowerPC::UpdateFPRFSingle(result.ps0);
 
   if (inst.Rc)
     PowerPC::ppcState.UpdateCR1();
@@ -356,11 +356,10 @@ void Interpreter::ps_muls0(UGeckoInstruction inst)
   const auto& c = rPS(inst.FC);
 
   const double c0 = Force25Bit(c.PS0AsDouble());
-  const float ps0 = ForceSingle(FPSCR, NI_mul(&FPSCR, a.PS0AsDouble(), c0).value);
-  const float ps1 = ForceSingle(FPSCR, NI_mul(&FPSCR, a.PS1AsDouble(), c0).value);
+  const PairedResult result = PairedMul(&FPSCR, a.PS0AsDouble(), a.PS1AsDouble(), c0, c0);
 
-  rPS(inst.FD).SetBoth(ps0, ps1);
-  PowerPC::UpdateFPRFSingle(ps0);
+  rPS(inst.FD).SetBoth(result.ps0, result.ps1);
+  PowerPC::UpdateFPRFSingle(result.ps0);
 
   if (inst.Rc)
     PowerPC::ppcState.UpdateCR1();
@@ -372,11 +371,10 @@ void Interpreter::ps_muls1(UGeckoInstruction inst)
   const auto& c = rPS(inst.FC);
 
   const double c1 = Force25Bit(c.PS1AsDouble());
-  const float ps0 = ForceSingle(FPSCR, NI_mul(&FPSCR, a.PS0AsDouble(), c1).value);
-  const float ps1 = ForceSingle(FPSCR, NI_mul(&FPSCR, a.PS1AsDouble(), c1).value);
+  const PairedResult result = PairedMul(&FPSCR, a.PS0AsDouble(), a.PS1AsDouble(), c1, c1);
 
-  rPS(inst.FD).SetBoth(ps0, ps1);
-  PowerPC::UpdateFPRFSingle(ps0);
+  rPS(inst.FD).SetBoth(result.ps0, result.ps1);
+  PowerPC::UpdateFPRFSingle(result.ps0);
 
   if (inst.Rc)
     PowerPC::ppcState.UpdateCR1();
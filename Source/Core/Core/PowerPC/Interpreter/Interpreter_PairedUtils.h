@@ -0,0 +1,115 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <limits>
+
+#include "Common/CommonTypes.h"
+#include "Common/Intrinsics.h"
+#include "Core/PowerPC/Gekko.h"
+#include "Core/PowerPC/Interpreter/Interpreter_FPUtils.h"
+
+// Both slots of a paired-single result, already rounded to single precision.
+struct PairedResult
+{
+  float ps0;
+  float ps1;
+};
+
+// The paired arithmetic helpers below compute both slots with one packed host operation whenever
+// the per-element NI_* helpers would leave FPSCR alone for both of them, i.e. when no operand is
+// infinite or NaN (and, for division, no divisor is zero). Anything else goes through the scalar
+// path, slot 0 first, exactly like the per-element code. The packed instructions share MXCSR with
+// the scalar ones, so rounding and flush-to-zero behave identically on both paths.
+
+#ifdef _M_X86
+inline __m128d PairedAbs(__m128d value)
+{
+  return _mm_andnot_pd(_mm_set1_pd(-0.0), value);
+}
+
+inline bool PairedAllFinite(__m128d a, __m128d b)
+{
+  const __m128d inf = _mm_set1_pd(std::numeric_limits<double>::infinity());
+  const __m128d finite =
+      _mm_and_pd(_mm_cmplt_pd(PairedAbs(a), inf), _mm_cmplt_pd(PairedAbs(b), inf));
+  return _mm_movemask_pd(finite) == 0x3;
+}
+
+// Packed equivalent of ForceSingle.
+inline PairedResult PairedForceSingle(const UReg_FPSCR& fpscr, __m128d value)
+{
+  if (fpscr.NI)
+  {
+    // Results that are subnormal as singles before rounding are flushed to a signed zero. Anything
+    // at or above the smallest normal single stays normal after rounding, so the FlushToZero that
+    // ForceSingle applies afterwards can never change the result here.
+    const __m128d smallest_normal_single = _mm_set1_pd(std::numeric_limits<float>::min());
+    const __m128d sign = _mm_and_pd(value, _mm_set1_pd(-0.0));
+    const __m128d flush = _mm_cmplt_pd(PairedAbs(value), smallest_normal_single);
+    value = _mm_or_pd(_mm_and_pd(flush, sign), _mm_andnot_pd(flush, value));
+  }
+
+  const __m128 result = _mm_cvtpd_ps(value);
+  return {_mm_cvtss_f32(result), _mm_cvtss_f32(_mm_shuffle_ps(result, result, 1))};
+}
+#endif
+
+inline PairedResult PairedAdd(UReg_FPSCR* fpscr, double a0, double a1, double b0, double b1)
+{
+#ifdef _M_X86
+  const __m128d a = _mm_set_pd(a1, a0);
+  const __m128d b = _mm_set_pd(b1, b0);
+  if (PairedAllFinite(a, b))
+    return PairedForceSingle(*fpscr, _mm_add_pd(a, b));
+#endif
+
+  const float ps0 = ForceSingle(*fpscr, NI_add(fpscr, a0, b0).value);
+  const float ps1 = ForceSingle(*fpscr, NI_add(fpscr, a1, b1).value);
+  return {ps0, ps1};
+}
+
+inline PairedResult PairedSub(UReg_FPSCR* fpscr, double a0, double a1, double b0, double b1)
+{
+#ifdef _M_X86
+  const __m128d a = _mm_set_pd(a1, a0);
+  const __m128d b = _mm_set_pd(b1, b0);
+  if (PairedAllFinite(a, b))
+    return PairedForceSingle(*fpscr, _mm_sub_pd(a, b));
+#endif
+
+  const float ps0 = ForceSingle(*fpscr, NI_sub(fpscr, a0, b0).value);
+  const float ps1 = ForceSingle(*fpscr, NI_sub(fpscr, a1, b1).value);
+  return {ps0, ps1};
+}
+
+// The caller is responsible for rounding c0 and c1 with Force25Bit first.
+inline PairedResult PairedMul(UReg_FPSCR* fpscr, double a0, double a1, double c0, double c1)
+{
+#ifdef _M_X86
+  const __m128d a = _mm_set_pd(a1, a0);
+  const __m128d c = _mm_set_pd(c1, c0);
+  if (PairedAllFinite(a, c))
+    return PairedForceSingle(*fpscr, _mm_mul_pd(a, c));
+#endif
+
+  const float ps0 = ForceSingle(*fpscr, NI_mul(fpscr, a0, c0).value);
+  const float ps1 = ForceSingle(*fpscr, NI_mul(fpscr, a1, c1).value);
+  return {ps0, ps1};
+}
+
+inline PairedResult PairedDiv(UReg_FPSCR* fpscr, double a0, double a1, double b0, double b1)
+{
+#ifdef _M_X86
+  const __m128d a = _mm_set_pd(a1, a0);
+  const __m128d b = _mm_set_pd(b1, b0);
+  const bool nonzero_divisors = _mm_movemask_pd(_mm_cmpneq_pd(b, _mm_setzero_pd())) == 0x3;
+  if (nonzero_divisors && PairedAllFinite(a, b))
+    return PairedForceSingle(*fpscr, _mm_div_pd(a, b));
+#endif
+
+  const float ps0 = ForceSingle(*fpscr, NI_div(fpscr, a0, b0).value);
+  const float ps1 = ForceSingle(*fpscr, NI_div(fpscr, a1, b1).value);
+  return {ps0, ps1};
+}
@@ -23,6 +23,7 @@
 #include "Common/PerformanceCounter.h"
 #include "Common/StringUtil.h"
 #include "Common/Swap.h"
+#include "Common/Timer.h"
 #include "Common/x64ABI.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
@@ -331,6 +332,7 @@ void Jit64::Init()
 
   jo.fastmem_arena = m_fastmem_enabled && Memory::InitFastmemArena();
   jo.optimizeGatherPipe = true;
+  jo.optimizeMMIOSites = true;
   jo.accurateSinglePrecision = true;
   UpdateMemoryAndExceptionOptions();
   js.fastmemLoadStore = nullptr;
@@ -378,6 +380,7 @@ void Jit64::Init()
 
 void Jit64::ClearCache()
 {
+  ++m_compile_stats.cache_clears;
   blocks.Clear();
   blocks.ClearRangesToFree();
   trampolines.ClearCodeSpace();
@@ -689,7 +692,7 @@ void Jit64::WriteRfiExitDestInRSCRATCH()
 void Jit64::WriteIdleExit(u32 destination)
 {
   ABI_PushRegistersAndAdjustStack({}, 0);
-  ABI_CallFunction(CoreTiming::Idle);
+  ABI_CallFunctionC(CoreTiming::Idle, destination);
   ABI_PopRegistersAndAdjustStack({}, 0);
   MOV(32, PPCSTATE(pc), Imm32(destination));
   WriteExceptionExit();
@@ -778,6 +781,7 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
     if (!SConfig::GetInstance().bJITNoBlockCache)
     {
       WARN_LOG_FMT(POWERPC, "flushing trampoline code cache, please report if this happens a lot");
+      ++m_compile_stats.trampoline_flushes;
     }
     ClearCache();
   }
@@ -817,6 +821,8 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
     }
   }
 
+  const u64 compile_start_us = Common::Timer::NowUs();
+
   // Analyze the block, collect all instructions it is made of (including inlining,
   // if that is enabled), reorder instructions for optimal performance, and join joinable
   // instructions.
@@ -858,15 +864,34 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
       b->far_end = far_end;
 
       blocks.FinalizeBlock(*b, jo.enableBlocklink, code_block.m_physical_addresses);
+
+      RecordCompiledBlock(Common::Timer::NowUs() - compile_start_us,
+                          code_block.m_num_instructions, near_end - near_start,
+                          far_end - far_start);
       return;
     }
+
+    // Code generation ran out of space, so this block won't be used.
+    blocks.DiscardBlock(*b);
   }
 
   if (clear_cache_and_retry_on_failure)
   {
     // Code generation failed due to not enough free space in either the near or far code regions.
-    // Clear the entire JIT cache and retry.
+    // Make room by evicting the coldest blocks and retry. If evicting doesn't free up enough
+    // contiguous space, clear the entire JIT cache and retry.
+    const size_t evicted_blocks = blocks.EvictColdBlocks();
+    if (evicted_blocks != 0)
+    {
+      DEBUG_LOG_FMT(POWERPC, "Evicted {} blocks to free up code space", evicted_blocks);
+      ++m_compile_stats.code_space_evictions;
+      m_compile_stats.blocks_evicted += evicted_blocks;
+      Jit(em_address, true);
+      return;
+    }
+
     WARN_LOG_FMT(POWERPC, "flushing code caches, please report if this happens a lot");
+    ++m_compile_stats.code_space_flushes;
     ClearCache();
     Jit(em_address, false);
     return;
@@ -881,7 +906,8 @@ void Jit64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
 bool Jit64::SetEmitterStateToFreeCodeRegion()
 {
   // Find the largest free memory blocks and set code emitters to point at them.
-  // If we can't find a free block return false instead, which will trigger a JIT cache clear.
+  // If we can't find a free block return false instead, which will trigger an eviction of cold
+  // blocks or a JIT cache clear.
   const auto free_near = m_free_ranges_near.by_size_begin();
   if (free_near == m_free_ranges_near.by_size_end())
   {
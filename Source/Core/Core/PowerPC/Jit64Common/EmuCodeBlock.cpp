@@ -17,6 +17,7 @@
 #include "Core/PowerPC/Jit64/Jit.h"
 #include "Core/PowerPC/Jit64Common/Jit64Constants.h"
 #include "Core/PowerPC/Jit64Common/Jit64PowerPCState.h"
+#include "Core/PowerPC/JitInterface.h"
 #include "Core/PowerPC/MMU.h"
 #include "Core/PowerPC/PowerPC.h"
 
@@ -318,6 +319,35 @@ void EmuCodeBlock::SafeLoadToReg(X64Reg reg_value, const Gen::OpArg& opAddress,
 
   auto& js = m_jit.js;
   registersInUse[reg_value] = false;
+
+  // If this load was seen reading the same MMIO register every time, inline the register read and
+  // only take the slow path if the address turns out to be different.
+  if (m_jit.jo.optimizeMMIOSites && !js.generatingTrampoline && !slowmem && accessSize != 64 &&
+      !(flags & SAFE_LOADSTORE_NO_UPDATE_PC) && opAddress.IsSimpleReg())
+  {
+    const auto site = js.mmioAccessSites.find(js.compilerPC);
+    if (site != js.mmioAccessSites.end() && site->second.inlined)
+    {
+      const u32 site_address = site->second.address;
+      const u32 mmio_address = PowerPC::IsOptimizableMMIOAccess(site_address, accessSize);
+      if (mmio_address)
+      {
+        CMP(32, opAddress, Imm32(site_address - offset));
+        FixupBranch other_address = J_CC(CC_NE, true);
+        MOV(64, R(RSCRATCH), ImmPtr(JitInterface::GetMMIOAccessCounter(mmio_address)));
+        ADD(32, MatR(RSCRATCH), Imm8(1));
+        MMIOLoadToReg(Memory::mmio_mapping.get(), reg_value, registersInUse, mmio_address,
+                      accessSize, signExtend);
+        FixupBranch done = J(true);
+        SetJumpTarget(other_address);
+        SafeLoadToReg(reg_value, opAddress, accessSize, offset, registersInUse, signExtend,
+                      flags | SAFE_LOADSTORE_FORCE_SLOWMEM);
+        SetJumpTarget(done);
+        return;
+      }
+    }
+  }
+
   if (m_jit.jo.fastmem && !(flags & (SAFE_LOADSTORE_NO_FASTMEM | SAFE_LOADSTORE_NO_UPDATE_PC)) &&
       !slowmem)
   {
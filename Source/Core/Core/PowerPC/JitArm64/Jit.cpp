@@ -12,6 +12,7 @@
 #include "Common/MsgHandler.h"
 #include "Common/PerformanceCounter.h"
 #include "Common/StringUtil.h"
+#include "Common/Timer.h"
 
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
@@ -128,6 +129,7 @@ bool JitArm64::HandleStackFault()
 
 void JitArm64::ClearCache()
 {
+  ++m_compile_stats.cache_clears;
   m_fault_to_handler.clear();
 
   blocks.Clear();
@@ -660,6 +662,8 @@ void JitArm64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
     block_size = 1;
   }
 
+  const u64 compile_start_us = Common::Timer::NowUs();
+
   // Analyze the block, collect all instructions it is made of (including inlining,
   // if that is enabled), reorder instructions for optimal performance, and join joinable
   // instructions.
@@ -701,15 +705,38 @@ void JitArm64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
       b->far_end = far_end;
 
       blocks.FinalizeBlock(*b, jo.enableBlocklink, code_block.m_physical_addresses);
+
+      RecordCompiledBlock(Common::Timer::NowUs() - compile_start_us,
+                          code_block.m_num_instructions, near_end - near_start,
+                          far_end - far_start);
       return;
     }
+
+    // Code generation ran out of space, so this block won't be used.
+    blocks.DiscardBlock(*b);
+
+    // Forget the fastmem areas of the partially generated code.
+    m_fault_to_handler.erase(m_fault_to_handler.lower_bound(near_start),
+                             m_fault_to_handler.lower_bound(GetWritableCodeEnd()));
   }
 
   if (clear_cache_and_retry_on_failure)
   {
     // Code generation failed due to not enough free space in either the near or far code regions.
-    // Clear the entire JIT cache and retry.
+    // Make room by evicting the coldest blocks and retry. If evicting doesn't free up enough
+    // contiguous space, clear the entire JIT cache and retry.
+    const size_t evicted_blocks = blocks.EvictColdBlocks();
+    if (evicted_blocks != 0)
+    {
+      DEBUG_LOG_FMT(POWERPC, "Evicted {} blocks to free up code space", evicted_blocks);
+      ++m_compile_stats.code_space_evictions;
+      m_compile_stats.blocks_evicted += evicted_blocks;
+      Jit(em_address, true);
+      return;
+    }
+
     WARN_LOG_FMT(POWERPC, "flushing code caches, please report if this happens a lot");
+    ++m_compile_stats.code_space_flushes;
     ClearCache();
     Jit(em_address, false);
     return;
@@ -724,7 +751,8 @@ void JitArm64::Jit(u32 em_address, bool clear_cache_and_retry_on_failure)
 bool JitArm64::SetEmitterStateToFreeCodeRegion()
 {
   // Find the largest free memory blocks and set code emitters to point at them.
-  // If we can't find a free block return false instead, which will trigger a JIT cache clear.
+  // If we can't find a free block return false instead, which will trigger an eviction of cold
+  // blocks or a JIT cache clear.
   auto free_near = m_free_ranges_near.by_size_begin();
   if (free_near == m_free_ranges_near.by_size_end())
   {
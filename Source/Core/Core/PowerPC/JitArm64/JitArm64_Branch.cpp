@@ -102,12 +102,9 @@ void JitArm64::bx(UGeckoInstruction inst)
   if (js.op->branchIsIdleLoop)
   {
     // make idle loops go faster
-    ARM64Reg WA = gpr.GetReg();
-    ARM64Reg XA = EncodeRegTo64(WA);
-
-    MOVP2R(XA, &CoreTiming::Idle);
-    BLR(XA);
-    gpr.Unlock(WA);
+    MOVP2R(ARM64Reg::X8, &CoreTiming::Idle);
+    MOVI2R(ARM64Reg::W0, js.op->branchTo);
+    BLR(ARM64Reg::X8);
 
     WriteExceptionExit(js.op->branchTo);
     return;
@@ -159,10 +156,9 @@ void JitArm64::bcx(UGeckoInstruction inst)
   if (js.op->branchIsIdleLoop)
   {
     // make idle loops go faster
-    ARM64Reg XA = EncodeRegTo64(WA);
-
-    MOVP2R(XA, &CoreTiming::Idle);
-    BLR(XA);
+    MOVP2R(ARM64Reg::X8, &CoreTiming::Idle);
+    MOVI2R(ARM64Reg::W0, js.op->branchTo);
+    BLR(ARM64Reg::X8);
 
     WriteExceptionExit(js.op->branchTo);
   }
@@ -279,10 +275,9 @@ void JitArm64::bclrx(UGeckoInstruction inst)
   if (js.op->branchIsIdleLoop)
   {
     // make idle loops go faster
-    ARM64Reg XA = EncodeRegTo64(WA);
-
-    MOVP2R(XA, &CoreTiming::Idle);
-    BLR(XA);
+    MOVP2R(ARM64Reg::X8, &CoreTiming::Idle);
+    MOVI2R(ARM64Reg::W0, js.op->branchTo);
+    BLR(ARM64Reg::X8);
 
     WriteExceptionExit(js.op->branchTo);
   }
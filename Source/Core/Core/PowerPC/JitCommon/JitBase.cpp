@@ -3,6 +3,9 @@
 
 #include "Core/PowerPC/JitCommon/JitBase.h"
 
+#include <algorithm>
+#include <bit>
+
 #include "Common/CommonTypes.h"
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
@@ -96,3 +99,16 @@ bool JitBase::ShouldHandleFPExceptionForInstruction(const PPCAnalyst::CodeOp* op
   else
     return false;
 }
+
+void JitBase::RecordCompiledBlock(u64 compile_time_us, u32 guest_instructions,
+                                  std::size_t near_bytes, std::size_t far_bytes)
+{
+  const std::size_t bucket = std::min<std::size_t>(std::bit_width(compile_time_us),
+                                                   JitCompileStats::NUM_COMPILE_TIME_BUCKETS - 1);
+  ++m_compile_stats.compile_time_buckets[bucket];
+  m_compile_stats.compile_time_us += compile_time_us;
+  ++m_compile_stats.blocks_compiled;
+  m_compile_stats.guest_instructions += guest_instructions;
+  m_compile_stats.near_code_bytes += near_bytes;
+  m_compile_stats.far_code_bytes += far_bytes;
+}
@@ -3,8 +3,10 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <map>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "Common/BitSet.h"
@@ -38,6 +40,39 @@
 
 #define JITDISABLE(setting) FALLBACK_IF(bJITOff || setting)
 
+// Counters describing the work done by the block compiler since they were last reset.
+struct JitCompileStats
+{
+  // Bucket i counts blocks that took less than 2^i microseconds to compile (and at least 2^(i-1)).
+  // The last bucket also counts everything slower.
+  static constexpr std::size_t NUM_COMPILE_TIME_BUCKETS = 16;
+
+  std::array<u64, NUM_COMPILE_TIME_BUCKETS> compile_time_buckets{};
+  u64 compile_time_us = 0;
+  u64 blocks_compiled = 0;
+  u64 guest_instructions = 0;
+  u64 near_code_bytes = 0;
+  u64 far_code_bytes = 0;
+
+  // Every full cache clear, and the ones the compiler itself did because the code regions or the
+  // trampoline region ran out of space. The rest were requested from outside, e.g. by settings
+  // changes or savestate loads.
+  u64 cache_clears = 0;
+  u64 code_space_flushes = 0;
+  u64 trampoline_flushes = 0;
+
+  // Times the compiler ran out of code space and evicted cold blocks instead of clearing the
+  // cache, and the number of blocks it evicted.
+  u64 code_space_evictions = 0;
+  u64 blocks_evicted = 0;
+
+  // Invalidations that destroyed blocks, by cause: code modified by the game (icbi, DMA) or
+  // recompiles forced by the emulator (breakpoints, profile-driven specialization).
+  u64 code_modified_invalidations = 0;
+  u64 forced_invalidations = 0;
+  u64 blocks_invalidated = 0;
+};
+
 class JitBase : public CPUCoreBase
 {
 protected:
@@ -58,6 +93,7 @@ protected:
   {
     bool enableBlocklink;
     bool optimizeGatherPipe;
+    bool optimizeMMIOSites;
     bool accurateSinglePrecision;
     bool fastmem;
     bool fastmem_arena;
@@ -66,6 +102,17 @@ protected:
     bool div_by_zero_exceptions;
     bool profile_blocks;
   };
+  // A load that was seen accessing MMIO from the slow path.
+  struct MMIOAccessSite
+  {
+    u32 address;
+    u32 count;
+    // Set once the load has been seen accessing more than one address.
+    bool polymorphic;
+    // Set once the load should be compiled with the register access inlined.
+    bool inlined;
+  };
+
   struct JitState
   {
     u32 compilerPC;
@@ -106,6 +153,7 @@ protected:
     std::unordered_set<u32> fifoWriteAddresses;
     std::unordered_set<u32> pairedQuantizeAddresses;
     std::unordered_set<u32> noSpeculativeConstantsAddresses;
+    std::unordered_map<u32, MMIOAccessSite> mmioAccessSites;
   };
 
   PPCAnalyst::CodeBlock code_block;
@@ -143,12 +191,21 @@ protected:
 
   bool ShouldHandleFPExceptionForInstruction(const PPCAnalyst::CodeOp* op);
 
+  void RecordCompiledBlock(u64 compile_time_us, u32 guest_instructions, std::size_t near_bytes,
+                           std::size_t far_bytes);
+
+  JitCompileStats m_compile_stats;
+
 public:
   JitBase();
   ~JitBase() override;
 
   bool IsDebuggingEnabled() const { return m_enable_debugging; }
 
+  const JitCompileStats& GetCompileStats() const { return m_compile_stats; }
+  JitCompileStats& GetCompileStats() { return m_compile_stats; }
+  void ResetCompileStats() { m_compile_stats = {}; }
+
   static const u8* Dispatch(JitBase& jit);
   virtual JitBaseBlockCache* GetBlockCache() = 0;
 
@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
 #include <cstring>
 #include <functional>
 #include <map>
@@ -59,6 +60,7 @@ void JitBaseBlockCache::Clear()
 #endif
   m_jit.js.fifoWriteAddresses.clear();
   m_jit.js.pairedQuantizeAddresses.clear();
+  m_jit.js.mmioAccessSites.clear();
   for (auto& e : block_map)
   {
     DestroyBlock(e.second);
@@ -70,6 +72,9 @@ void JitBaseBlockCache::Clear()
   valid_block.ClearAll();
 
   fast_block_map.fill(nullptr);
+
+  m_next_eviction_window = 0;
+  m_evictions_since_finalize = 0;
 }
 
 void JitBaseBlockCache::Reset()
@@ -104,6 +109,8 @@ JitBlock* JitBaseBlockCache::AllocateBlock(u32 em_address)
 void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
                                       const std::set<u32>& physical_addresses)
 {
+  m_evictions_since_finalize = 0;
+
   size_t index = FastLookupIndexForAddress(block.effectiveAddress);
   fast_block_map[index] = &block;
   block.fast_block_map_index = index;
@@ -141,6 +148,106 @@ void JitBaseBlockCache::FinalizeBlock(JitBlock& block, bool block_link,
   }
 }
 
+void JitBaseBlockCache::DiscardBlock(JitBlock& block)
+{
+  auto iter = block_map.equal_range(block.physicalAddress);
+  for (; iter.first != iter.second; iter.first++)
+  {
+    if (&iter.first->second == &block)
+    {
+      block_map.erase(iter.first);
+      return;
+    }
+  }
+}
+
+size_t JitBaseBlockCache::EvictColdBlocks()
+{
+  if (block_map.empty() || m_evictions_since_finalize >= NUM_EVICTION_WINDOWS)
+    return 0;
+
+  // Find the host code occupied by blocks.
+  uintptr_t near_begin = UINTPTR_MAX, near_end = 0;
+  uintptr_t far_begin = UINTPTR_MAX, far_end = 0;
+  for (const auto& e : block_map)
+  {
+    const JitBlock& block = e.second;
+    if (block.near_begin != block.near_end)
+    {
+      near_begin = std::min(near_begin, reinterpret_cast<uintptr_t>(block.near_begin));
+      near_end = std::max(near_end, reinterpret_cast<uintptr_t>(block.near_end));
+    }
+    if (block.far_begin != block.far_end)
+    {
+      far_begin = std::min(far_begin, reinterpret_cast<uintptr_t>(block.far_begin));
+      far_end = std::max(far_end, reinterpret_cast<uintptr_t>(block.far_end));
+    }
+  }
+
+  const auto window_of = [](const u8* code, uintptr_t begin, uintptr_t end) {
+    const u64 offset = reinterpret_cast<uintptr_t>(code) - begin;
+    return static_cast<u32>(std::min<u64>(offset * NUM_EVICTION_WINDOWS / (end - begin),
+                                          NUM_EVICTION_WINDOWS - 1));
+  };
+
+  // Pick the window whose blocks ran the least. Ties, which includes every window when block
+  // profiling is disabled, go to the first window after the one evicted last time.
+  std::array<u64, NUM_EVICTION_WINDOWS> run_counts{};
+  if (m_jit.jo.profile_blocks && near_begin < near_end)
+  {
+    for (const auto& e : block_map)
+    {
+      const JitBlock& block = e.second;
+      if (block.near_begin == block.near_end)
+        continue;
+      const u32 window = window_of(block.near_begin, near_begin, near_end);
+      run_counts[window] += block.profile_data.runCount;
+    }
+  }
+
+  u32 victim = m_next_eviction_window;
+  for (u32 i = 1; i < NUM_EVICTION_WINDOWS; ++i)
+  {
+    const u32 window = (m_next_eviction_window + i) % NUM_EVICTION_WINDOWS;
+    if (run_counts[window] < run_counts[victim])
+      victim = window;
+  }
+  m_next_eviction_window = (victim + 1) % NUM_EVICTION_WINDOWS;
+  ++m_evictions_since_finalize;
+
+  const auto overlaps_victim = [&](const u8* begin, const u8* end, uintptr_t region_begin,
+                                   uintptr_t region_end) {
+    if (begin == end)
+      return false;
+    const u32 first = window_of(begin, region_begin, region_end);
+    const u32 last = window_of(end - 1, region_begin, region_end);
+    return first <= victim && victim <= last;
+  };
+
+  size_t evicted = 0;
+  auto iter = block_map.begin();
+  while (iter != block_map.end())
+  {
+    JitBlock& block = iter->second;
+    if (overlaps_victim(block.near_begin, block.near_end, near_begin, near_end) ||
+        overlaps_victim(block.far_begin, block.far_end, far_begin, far_end))
+    {
+      // The destroyed block's code ranges become free on the next codegen, and any block linked
+      // to it is relinked to the dispatcher.
+      RemoveFromBlockRangeMap(block);
+      DestroyBlock(block);
+      iter = block_map.erase(iter);
+      ++evicted;
+    }
+    else
+    {
+      iter++;
+    }
+  }
+
+  return evicted;
+}
+
 JitBlock* JitBaseBlockCache::GetBlockFromStartAddress(u32 addr, u32 msr)
 {
   u32 translated_addr = addr;
@@ -243,7 +350,11 @@ void JitBaseBlockCache::InvalidateICacheInternal(u32 physical_address, u32 addre
   if (destroy_block)
   {
     // destroy JIT blocks
+    JitCompileStats& stats = m_jit.GetCompileStats();
+    const u64 blocks_invalidated = stats.blocks_invalidated;
     ErasePhysicalRange(physical_address, length);
+    if (stats.blocks_invalidated != blocks_invalidated)
+      ++(forced ? stats.forced_invalidations : stats.code_modified_invalidations);
 
     // If the code was actually modified, we need to clear the relevant entries from the
     // FIFO write address cache, so we don't end up with FIFO checks in places they shouldn't
@@ -255,6 +366,7 @@ void JitBaseBlockCache::InvalidateICacheInternal(u32 physical_address, u32 addre
       {
         m_jit.js.fifoWriteAddresses.erase(i);
         m_jit.js.pairedQuantizeAddresses.erase(i);
+        m_jit.js.mmioAccessSites.erase(i);
       }
     }
   }
@@ -283,6 +395,7 @@ void JitBaseBlockCache::ErasePhysicalRange(u32 address, u32 length)
 
         // And remove the block.
         DestroyBlock(*block);
+        ++m_jit.GetCompileStats().blocks_invalidated;
         auto block_map_iter = block_map.equal_range(block->physicalAddress);
         while (block_map_iter.first != block_map_iter.second)
         {
@@ -309,6 +422,20 @@ void JitBaseBlockCache::ErasePhysicalRange(u32 address, u32 length)
   }
 }
 
+void JitBaseBlockCache::RemoveFromBlockRangeMap(JitBlock& block)
+{
+  const u32 range_mask = ~(BLOCK_RANGE_MAP_ELEMENTS - 1);
+  for (u32 addr : block.physical_addresses)
+  {
+    const auto iter = block_range_map.find(addr & range_mask);
+    if (iter == block_range_map.end())
+      continue;
+    iter->second.erase(&block);
+    if (iter->second.empty())
+      block_range_map.erase(iter);
+  }
+}
+
 u32* JitBaseBlockCache::GetBlockBitSet() const
 {
   return valid_block.m_valid_block.get();
@@ -134,6 +134,8 @@ public:
   static constexpr u32 FAST_BLOCK_MAP_ELEMENTS = 0x10000;
   static constexpr u32 FAST_BLOCK_MAP_MASK = FAST_BLOCK_MAP_ELEMENTS - 1;
 
+  static constexpr u32 NUM_EVICTION_WINDOWS = 8;
+
   explicit JitBaseBlockCache(JitBase& jit);
   virtual ~JitBaseBlockCache();
 
@@ -148,6 +150,17 @@ public:
 
   JitBlock* AllocateBlock(u32 em_address);
   void FinalizeBlock(JitBlock& block, bool block_link, const std::set<u32>& physical_addresses);
+  // Removes a block returned by AllocateBlock that was never finalized, e.g. because code
+  // generation ran out of space.
+  void DiscardBlock(JitBlock& block);
+
+  // Frees host code space without clearing the whole cache. The host code occupied by blocks is
+  // split into NUM_EVICTION_WINDOWS slices, separately for the near and far code, and every block
+  // with code in the coldest pair of slices is destroyed. Blocks are ranked by their profiling
+  // run counts if block profiling is enabled; otherwise the slices are evicted in turn.
+  // Returns the number of destroyed blocks, or 0 once every slice has been evicted without a
+  // block being finalized in between, in which case the caller should clear the cache instead.
+  size_t EvictColdBlocks();
 
   // Look for the block in the slow but accurate way.
   // This function shall be used if FastLookupIndexForAddress() failed.
@@ -179,6 +192,7 @@ private:
   void LinkBlock(JitBlock& block);
   void UnlinkBlock(const JitBlock& block);
   void InvalidateICacheInternal(u32 physical_address, u32 address, u32 length, bool forced);
+  void RemoveFromBlockRangeMap(JitBlock& block);
 
   JitBlock* MoveBlockIntoFastCache(u32 em_address, u32 msr);
 
@@ -206,4 +220,9 @@ private:
   // This array is indexed with the masked PC and likely holds the correct block id.
   // This is used as a fast cache of block_map used in the assembly dispatcher.
   std::array<JitBlock*, FAST_BLOCK_MAP_ELEMENTS> fast_block_map{};  // start_addr & mask -> number
+
+  // The eviction window to consider first next time, and how many windows have been evicted since
+  // a block was last finalized.
+  u32 m_next_eviction_window = 0;
+  u32 m_evictions_since_finalize = 0;
 };
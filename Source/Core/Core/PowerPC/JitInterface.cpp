@@ -4,6 +4,7 @@
 #include "Core/PowerPC/JitInterface.h"
 
 #include <algorithm>
+#include <array>
 #include <cstdio>
 #include <string>
 #include <unordered_set>
@@ -19,9 +20,11 @@
 #include "Common/ChunkFile.h"
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
+#include "Common/Logging/Log.h"
 #include "Common/MsgHandler.h"
 
 #include "Core/Core.h"
+#include "Core/HW/MMIO.h"
 #include "Core/PowerPC/CPUCoreBase.h"
 #include "Core/PowerPC/CachedInterpreter/CachedInterpreter.h"
 #include "Core/PowerPC/JitCommon/JitBase.h"
@@ -41,6 +44,14 @@
 namespace JitInterface
 {
 static JitBase* g_jit = nullptr;
+
+// Number of slow path accesses after which a load that keeps reading the same MMIO register gets
+// that register access inlined.
+constexpr u32 MMIO_SITE_THRESHOLD = 64;
+
+// Access counts of every 16-bit MMIO register, indexed by MMIO::UniqueID / 2.
+static std::array<u32, MMIO::NUM_MMIOS / 2> s_mmio_access_counts;
+
 void SetJit(JitBase* jit)
 {
   g_jit = jit;
@@ -52,6 +63,8 @@ void DoState(PointerWrap& p)
 }
 CPUCoreBase* InitJitCore(PowerPC::CPUCore core)
 {
+  s_mmio_access_counts.fill(0);
+
   switch (core)
   {
 #if _M_X86
@@ -91,6 +104,70 @@ void SetProfilingState(ProfilingState state)
   g_jit->jo.profile_blocks = state == ProfilingState::Enabled;
 }
 
+static std::string FormatCompileStats(const JitCompileStats& stats)
+{
+  if (stats.blocks_compiled == 0)
+    return "No blocks compiled\n";
+
+  const double blocks = static_cast<double>(stats.blocks_compiled);
+  const double instructions = static_cast<double>(std::max<u64>(stats.guest_instructions, 1));
+
+  std::string result = fmt::format(
+      "Blocks compiled: {} ({} guest instructions)\n"
+      "Compile time: {:.2f} ms total, {:.2f} us per block\n"
+      "Host code: {} near bytes ({:.2f} per instruction), {} far bytes ({:.2f} per instruction)\n",
+      stats.blocks_compiled, stats.guest_instructions, stats.compile_time_us / 1000.0,
+      stats.compile_time_us / blocks, stats.near_code_bytes,
+      stats.near_code_bytes / instructions, stats.far_code_bytes,
+      stats.far_code_bytes / instructions);
+
+  result += "Compile time histogram:\n";
+  for (std::size_t i = 0; i < stats.compile_time_buckets.size(); ++i)
+  {
+    const u64 count = stats.compile_time_buckets[i];
+    if (count == 0)
+      continue;
+    if (i == stats.compile_time_buckets.size() - 1)
+      result += fmt::format("  >={}us\t{}\n", u64{1} << (i - 1), count);
+    else
+      result += fmt::format("  <{}us\t{}\n", u64{1} << i, count);
+  }
+
+  result += fmt::format("Cache clears: {} (code space full: {}, trampolines full: {}, other: {})\n",
+                        stats.cache_clears, stats.code_space_flushes, stats.trampoline_flushes,
+                        stats.cache_clears - stats.code_space_flushes -
+                            stats.trampoline_flushes);
+  result += fmt::format("Code space evictions: {} ({} blocks)\n", stats.code_space_evictions,
+                        stats.blocks_evicted);
+  result += fmt::format("Invalidations: {} code modified, {} forced, {} blocks destroyed\n",
+                        stats.code_modified_invalidations, stats.forced_invalidations,
+                        stats.blocks_invalidated);
+  return result;
+}
+
+JitCompileStats GetCompileStats()
+{
+  if (!g_jit)
+    return {};
+
+  JitCompileStats stats;
+  Core::RunAsCPUThread([&stats] { stats = g_jit->GetCompileStats(); });
+  return stats;
+}
+
+void ResetCompileStats()
+{
+  if (!g_jit)
+    return;
+
+  Core::RunAsCPUThread([] { g_jit->ResetCompileStats(); });
+}
+
+std::string GetCompileStatsSummary()
+{
+  return FormatCompileStats(GetCompileStats());
+}
+
 void WriteProfileResults(const std::string& filename)
 {
   Profiler::ProfileStats prof_stats;
@@ -116,6 +193,22 @@ void WriteProfileResults(const std::string& filename)
                                   static_cast<double>(prof_stats.countsPerSec),
                               stat.block_size));
   }
+
+  std::array<u32, MMIO::NUM_MMIOS / 2> mmio_access_counts;
+  Core::RunAsCPUThread([&mmio_access_counts] { mmio_access_counts = s_mmio_access_counts; });
+  f.WriteString("\nmmioAddr\taccessCount\n");
+  for (u32 i = 0; i < mmio_access_counts.size(); ++i)
+  {
+    if (mmio_access_counts[i] == 0)
+      continue;
+    const u32 unique_id = i * 2;
+    const u32 address = ((unique_id >> 16) == MMIO::WII_BLOCK ? 0x0D000000 : 0x0C000000) |
+                        (unique_id & 0xFFFF);
+    f.WriteString(fmt::format("{:08x}\t{}\n", address, mmio_access_counts[i]));
+  }
+
+  f.WriteString("\n");
+  f.WriteString(GetCompileStatsSummary());
 }
 
 void GetProfileResults(Profiler::ProfileStats* prof_stats)
@@ -282,10 +375,62 @@ void CompileExceptionCheck(ExceptionType type)
   }
 }
 
+void RecordMMIOAccess(u32 effective_address, u32 physical_address, bool is_write)
+{
+  ++*GetMMIOAccessCounter(physical_address);
+
+  // Only loads are specialized, since the JIT can't inline MMIO writes for non-constant addresses.
+  if (!g_jit || !g_jit->jo.optimizeMMIOSites || is_write || PC == 0)
+    return;
+
+  auto& site = g_jit->js.mmioAccessSites[PC];
+  if (site.polymorphic)
+    return;
+
+  if (site.count == 0)
+  {
+    site.address = effective_address;
+  }
+  else if (site.address != effective_address)
+  {
+    site.polymorphic = true;
+    // Recompile the load without the specialization if it was already inlined.
+    if (site.inlined)
+    {
+      site.inlined = false;
+      g_jit->GetBlockCache()->InvalidateICache(PC, 4, true);
+    }
+    return;
+  }
+
+  if (site.count < MMIO_SITE_THRESHOLD && ++site.count == MMIO_SITE_THRESHOLD)
+  {
+    // The PC isn't updated by every slow path access, so make sure this is actually a load.
+    const OpType optype = PPCTables::GetOpInfo(PowerPC::HostRead_U32(PC))->type;
+    if (optype != OpType::Load)
+    {
+      site.polymorphic = true;
+      return;
+    }
+
+    site.inlined = true;
+    g_jit->GetBlockCache()->InvalidateICache(PC, 4, true);
+  }
+}
+
+u32* GetMMIOAccessCounter(u32 physical_address)
+{
+  return &s_mmio_access_counts[MMIO::UniqueID(physical_address) / 2];
+}
+
 void Shutdown()
 {
   if (g_jit)
   {
+    const JitCompileStats& stats = g_jit->GetCompileStats();
+    if (stats.blocks_compiled != 0)
+      INFO_LOG_FMT(POWERPC, "JIT compile statistics:\n{}", FormatCompileStats(stats));
+
     g_jit->Shutdown();
     delete g_jit;
     g_jit = nullptr;
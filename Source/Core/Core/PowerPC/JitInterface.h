@@ -11,6 +11,7 @@
 class CPUCoreBase;
 class PointerWrap;
 class JitBase;
+struct JitCompileStats;
 
 namespace PowerPC
 {
@@ -48,6 +49,11 @@ void WriteProfileResults(const std::string& filename);
 void GetProfileResults(Profiler::ProfileStats* prof_stats);
 int GetHostCode(u32* address, const u8** code, u32* code_size);
 
+// Block compiler statistics gathered since the JIT was created or they were last reset.
+JitCompileStats GetCompileStats();
+void ResetCompileStats();
+std::string GetCompileStatsSummary();
+
 // Memory Utilities
 bool HandleFault(uintptr_t access_address, SContext* ctx);
 bool HandleStackFault();
@@ -67,6 +73,14 @@ void InvalidateICacheLines(u32 address, u32 count);
 
 void CompileExceptionCheck(ExceptionType type);
 
+// Called for every load or store that reaches an MMIO register through the slow path. Counts the
+// access, and once a load has read the same register often enough, recompiles its block with
+// the register access inlined.
+void RecordMMIOAccess(u32 effective_address, u32 physical_address, bool is_write);
+// Returns the access counter of the MMIO register at the given physical address, for inlined
+// accesses to bump.
+u32* GetMMIOAccessCounter(u32 physical_address);
+
 /// used for the page fault unit test, don't use outside of tests!
 void SetJit(JitBase* jit);
 
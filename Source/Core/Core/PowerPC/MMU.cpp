@@ -187,6 +187,7 @@ static T ReadFromHardware(u32 em_address)
     return static_cast<T>(var);
   }
 
+  const u32 effective_address = em_address;
   if (!never_translate && MSR.DR)
   {
     auto translated_addr = TranslateAddress<flag>(em_address);
@@ -203,8 +204,9 @@ static T ReadFromHardware(u32 em_address)
   {
     if (em_address < 0x0c000000)
       return EFB_Read(em_address);
-    else
-      return static_cast<T>(Memory::mmio_mapping->Read<std::make_unsigned_t<T>>(em_address));
+
+    JitInterface::RecordMMIOAccess(effective_address, em_address, false);
+    return static_cast<T>(Memory::mmio_mapping->Read<std::make_unsigned_t<T>>(em_address));
   }
 
   // Locked L1 technically doesn't have a fixed address, but games all use 0xE0000000.
@@ -269,6 +271,7 @@ static void WriteToHardware(u32 em_address, const u32 data, const u32 size)
 
   bool wi = false;
 
+  const u32 effective_address = em_address;
   if (!never_translate && MSR.DR)
   {
     auto translated_addr = TranslateAddress<flag>(em_address);
@@ -325,6 +328,7 @@ static void WriteToHardware(u32 em_address, const u32 data, const u32 size)
       return;
     }
 
+    JitInterface::RecordMMIOAccess(effective_address, em_address, true);
     switch (size)
     {
     case 1:
@@ -1173,6 +1177,8 @@ static void GenerateISIException(u32 effective_address)
   WARN_LOG_FMT(POWERPC, "ISI exception at {:#010x}", PC);
 }
 
+static void MapPage(u32 logical_address, u32 translated_address);
+
 void SDRUpdated()
 {
   const auto sdr = UReg_SDR1{ppcState.spr[SPR_SDR]};
@@ -1191,6 +1197,16 @@ void SDRUpdated()
 
   ppcState.pagetable_base = htaborg << 16;
   ppcState.pagetable_hashmask = ((htabmask << 10) | 0x3ff);
+
+  // Every page table mapping may be stale now. They are recreated by the next page table walk
+  // for each page.
+  Memory::ClearPageTableMappings();
+}
+
+void SRUpdated(u32 index)
+{
+  // Only translations in this segment depend on the segment register.
+  Memory::RemovePageTableMappings(index << 28, 1u << 28);
 }
 
 enum class TLBLookupResult
@@ -1275,6 +1291,8 @@ void InvalidateTLBEntry(u32 address)
 
   ppcState.tlb[0][entry_index].Invalidate();
   ppcState.tlb[1][entry_index].Invalidate();
+
+  Memory::RemovePageTableMappings(entry_index);
 }
 
 union EffectiveAddress
@@ -1380,6 +1398,12 @@ static TranslateAddressResult TranslatePageAddress(const EffectiveAddress addres
 
         *wi = (pte2.WIMG & 0b1100) != 0;
 
+        // Once the R and C bits are set, further accesses to the page don't have to update the page
+        // table entry, so the JIT can access it directly.
+        if ((flag == XCheckTLBFlag::Read || flag == XCheckTLBFlag::Write) && pte2.R == 1 &&
+            pte2.C == 1 && !*wi)
+          MapPage(address.Hex & ~HW_PAGE_MASK, pte2.RPN << HW_PAGE_INDEX_SHIFT);
+
         return TranslateAddressResult{TranslateAddressResultEnum::PAGE_TABLE_TRANSLATED,
                                       (pte2.RPN << 12) | offset};
       }
@@ -1388,6 +1412,22 @@ static TranslateAddressResult TranslatePageAddress(const EffectiveAddress addres
   return TranslateAddressResult{TranslateAddressResultEnum::PAGE_FAULT, 0};
 }
 
+static void MapPage(u32 logical_address, u32 translated_address)
+{
+  if (!Memory::IsPageTableFastmemEnabled())
+    return;
+
+  // BAT translations take priority over the page table, and accesses to pages with memchecks
+  // have to fault so that they reach the slow path.
+  if (dbat_table[logical_address >> BAT_INDEX_SHIFT] & BAT_MAPPED_BIT)
+    return;
+  if (memchecks.OverlapsMemcheck(logical_address, HW_PAGE_SIZE))
+    return;
+
+  Memory::AddPageTableMapping(logical_address, translated_address,
+                              (logical_address >> HW_PAGE_INDEX_SHIFT) & HW_PAGE_INDEX_MASK);
+}
+
 static void UpdateBATs(BatTable& bat_table, u32 base_spr)
 {
   // TODO: Separate BATs for MSR.PR==0 and MSR.PR==1
@@ -678,57 +678,100 @@ void PPCAnalyzer::SetInstructionStats(CodeBlock* block, CodeOp* code, const Gekk
   }
 }
 
-bool PPCAnalyzer::IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instructions) const
+static bool IsWaitLoopSafeOp(const CodeOp& op)
+{
+  const UGeckoInstruction inst = op.inst;
+  switch (op.opinfo->type)
+  {
+  case OpType::Integer:
+  case OpType::Load:
+  case OpType::LoadFP:
+    return true;
+  case OpType::System:
+    // sync and eieio are commonly used to order the reads of MMIO polling loops.
+    return inst.OPCD == 31 && (inst.SUBOP10 == 598 || inst.SUBOP10 == 854);
+  case OpType::DataCache:
+    // dcbst, dcbf, dcbi, dcbt and dcbtst only affect caching, which doesn't change what the next
+    // iteration reads from memory we emulate. Loops polling memory shared with the DSP or IOS
+    // use them to see the new value. dcbz writes to memory, so it isn't allowed.
+    return inst.OPCD == 31 && (inst.SUBOP10 == 54 || inst.SUBOP10 == 86 ||
+                               inst.SUBOP10 == 470 || inst.SUBOP10 == 278 ||
+                               inst.SUBOP10 == 246);
+  default:
+    return false;
+  }
+}
+
+bool PPCAnalyzer::IsBusyWaitLoop(CodeOp* code, size_t instructions) const
 {
   // Very basic algorithm to detect busy wait loops:
-  //   * It loops to itself and does not contain any other branches.
-  //   * It does not write to memory.
+  //   * It branches back to an earlier instruction of the block, and does not
+  //     contain any other branches.
+  //   * It does not write to memory or have other side effects.
   //   * It only reads from registers it wrote to earlier in the loop, or it
   //     does not write to these registers.
   //
-  // Would benefit a lot from basic inlining support - a lot of the most
-  // used busy loops are DSP register interactions, which are bl/cmp/bne
-  // (with the bl target a pure function that follows the above rules). We
-  // don't detect these at the moment.
+  // The loop may start in the middle of the block: blocks are only entered
+  // at their start, so the whole loop body has always run once when the
+  // branch is reached. Calls to pure leaf functions (the DSP register
+  // interactions are often bl/cmp/bne) are covered when branch following
+  // merges the callee into the block.
+  const CodeOp& branch = code[instructions];
+  if (branch.opinfo->type != OpType::Branch || branch.branchUsesCtr)
+    return false;
+
+  size_t loop_start = instructions + 1;
+  for (size_t i = instructions + 1; i-- > 0;)
+  {
+    if (code[i].address == branch.branchTo)
+    {
+      loop_start = i;
+      break;
+    }
+  }
+  if (loop_start > instructions)
+    return false;
+
   std::bitset<32> write_disallowed_regs;
   std::bitset<32> written_regs;
-  for (size_t i = 0; i <= instructions; ++i)
+  std::bitset<32> write_disallowed_fregs;
+  std::bitset<32> written_fregs;
+  for (size_t i = loop_start; i < instructions; ++i)
   {
     if (code[i].opinfo->type == OpType::Branch)
     {
       if (code[i].branchUsesCtr)
         return false;
-      if (code[i].branchTo == block->m_address && i == instructions)
-        return true;
+      continue;
     }
-    else if (code[i].opinfo->type != OpType::Integer && code[i].opinfo->type != OpType::Load)
-    {
-      // In the future, some subsets of other instruction types might get
-      // supported. Right now, only try loops that have this very
-      // restricted instruction set.
+
+    if (!IsWaitLoopSafeOp(code[i]))
       return false;
-    }
-    else
+
+    for (int reg : code[i].regsIn)
     {
-      for (int reg : code[i].regsIn)
-      {
-        if (reg == -1)
-          continue;
-        if (written_regs[reg])
-          continue;
+      if (!written_regs[reg])
         write_disallowed_regs[reg] = true;
-      }
-      for (int reg : code[i].regsOut)
-      {
-        if (reg == -1)
-          continue;
-        if (write_disallowed_regs[reg])
-          return false;
-        written_regs[reg] = true;
-      }
+    }
+    for (int reg : code[i].fregsIn)
+    {
+      if (!written_fregs[reg])
+        write_disallowed_fregs[reg] = true;
+    }
+    for (int reg : code[i].regsOut)
+    {
+      if (write_disallowed_regs[reg])
+        return false;
+      written_regs[reg] = true;
+    }
+    for (int reg : code[i].GetFregsOut())
+    {
+      if (write_disallowed_fregs[reg])
+        return false;
+      written_fregs[reg] = true;
     }
   }
-  return false;
+  return true;
 }
 
 u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
@@ -880,8 +923,7 @@ u32 PPCAnalyzer::Analyze(u32 address, CodeBlock* block, CodeBuffer* buffer,
       }
     }
 
-    code[i].branchIsIdleLoop =
-        code[i].branchTo == block->m_address && IsBusyWaitLoop(block, code, i);
+    code[i].branchIsIdleLoop = IsBusyWaitLoop(code, i);
 
     if (follow && numFollows < BRANCH_FOLLOWING_THRESHOLD)
     {
@@ -235,7 +235,7 @@ private:
   void ReorderInstructions(u32 instructions, CodeOp* code) const;
   void SetInstructionStats(CodeBlock* block, CodeOp* code, const GekkoOPInfo* opinfo,
                            u32 index) const;
-  bool IsBusyWaitLoop(CodeBlock* block, CodeOp* code, size_t instructions) const;
+  bool IsBusyWaitLoop(CodeOp* code, size_t instructions) const;
 
   // Options
   u32 m_options = 0;
@@ -634,7 +634,11 @@ void CheckBreakPoints()
 void PowerPCState::SetSR(u32 index, u32 value)
 {
   DEBUG_LOG_FMT(POWERPC, "{:08x}: MMU: Segment register {} set to {:08x}", pc, index, value);
+  if (sr[index] == value)
+    return;
+
   sr[index] = value;
+  SRUpdated(index);
 }
 
 // FPSCR update functions
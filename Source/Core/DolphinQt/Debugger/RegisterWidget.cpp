@@ -353,7 +353,7 @@ void RegisterWidget::PopulateTable()
     // SR registers
     AddRegister(
         i, 7, RegisterType::sr, "SR" + std::to_string(i), [i] { return PowerPC::ppcState.sr[i]; },
-        [i](u64 value) { PowerPC::ppcState.sr[i] = value; });
+        [i](u64 value) { PowerPC::ppcState.SetSR(i, static_cast<u32>(value)); });
   }
 
   // Special registers
@@ -25,6 +25,7 @@
 #include "Core/Config/MainSettings.h"
 #include "Core/ConfigManager.h"
 #include "Core/Core.h"
+#include "Core/CoreTiming.h"
 #include "Core/Debugger/RSO.h"
 #include "Core/HLE/HLE.h"
 #include "Core/HW/AddressSpace.h"
@@ -141,6 +142,8 @@ void MenuBar::OnEmulationStateChanged(Core::State state)
   m_jit_clear_cache->setEnabled(running);
   m_jit_log_coverage->setEnabled(!running);
   m_jit_search_instruction->setEnabled(running);
+  m_jit_log_compile_stats->setEnabled(running);
+  m_jit_log_idle_loops->setEnabled(running);
 
   for (QAction* action :
        {m_jit_off, m_jit_loadstore_off, m_jit_loadstore_lbzx_off, m_jit_loadstore_lxz_off,
@@ -853,6 +856,10 @@ void MenuBar::AddJITMenu()
       m_jit->addAction(tr("Log JIT Instruction Coverage"), this, &MenuBar::LogInstructions);
   m_jit_search_instruction =
       m_jit->addAction(tr("Search for an Instruction"), this, &MenuBar::SearchInstruction);
+  m_jit_log_compile_stats =
+      m_jit->addAction(tr("Log JIT Compile Statistics"), this, &MenuBar::LogCompileStats);
+  m_jit_log_idle_loops =
+      m_jit->addAction(tr("Log Idle Loop Summary"), this, &MenuBar::LogIdleLoops);
 
   m_jit->addSeparator();
 
@@ -1691,6 +1698,17 @@ void MenuBar::LogInstructions()
   PPCTables::LogCompiledInstructions();
 }
 
+void MenuBar::LogCompileStats()
+{
+  NOTICE_LOG_FMT(POWERPC, "JIT compile statistics:\n{}", JitInterface::GetCompileStatsSummary());
+}
+
+void MenuBar::LogIdleLoops()
+{
+  // The idle loop statistics are updated by the CPU thread.
+  Core::RunAsCPUThread([] { NOTICE_LOG_FMT(POWERPC, "{}", CoreTiming::GetIdleLoopSummary()); });
+}
+
 void MenuBar::SearchInstruction()
 {
   bool good;
@@ -177,6 +177,8 @@ private:
   void PatchHLEFunctions();
   void ClearCache();
   void LogInstructions();
+  void LogCompileStats();
+  void LogIdleLoops();
   void SearchInstruction();
 
   void OnSelectionChanged(std::shared_ptr<const UICommon::GameFile> game_file);
@@ -261,6 +263,8 @@ private:
   QAction* m_jit_clear_cache;
   QAction* m_jit_log_coverage;
   QAction* m_jit_search_instruction;
+  QAction* m_jit_log_compile_stats;
+  QAction* m_jit_log_idle_loops;
   QAction* m_jit_off;
   QAction* m_jit_loadstore_off;
   QAction* m_jit_loadstore_lbzx_off;
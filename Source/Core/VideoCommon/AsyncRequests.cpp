@@ -86,7 +86,10 @@ void AsyncRequests::PushEvent(const AsyncRequests::Event& event, bool blocking)
   m_wake_me_up_again |= blocking;
 
   if (!m_enable)
+  {
+    DropEvent(event);
     return;
+  }
 
   m_queue.push(event);
 
@@ -112,12 +115,22 @@ void AsyncRequests::SetEnable(bool enable)
   {
     // flush the queue on disabling
     while (!m_queue.empty())
+    {
+      DropEvent(m_queue.front());
       m_queue.pop();
+    }
     if (m_wake_me_up_again)
       m_cond.notify_all();
   }
 }
 
+void AsyncRequests::DropEvent(const AsyncRequests::Event& e)
+{
+  // A requested bounding box latch has to be marked as done, or no new one can be requested.
+  if (e.type == Event::BBOX_LATCH && g_renderer)
+    g_renderer->BBoxCancelLatch();
+}
+
 void AsyncRequests::HandleEvent(const AsyncRequests::Event& e)
 {
   switch (e.type)
@@ -158,6 +171,10 @@ void AsyncRequests::HandleEvent(const AsyncRequests::Event& e)
     *e.bbox.data = g_renderer->BBoxRead(e.bbox.index);
     break;
 
+  case Event::BBOX_LATCH:
+    g_renderer->BBoxLatch();
+    break;
+
   case Event::FIFO_RESET:
     Fifo::ResetVideoBuffer();
     break;
@@ -27,6 +27,7 @@ public:
       EFB_PEEK_Z,
       SWAP_EVENT,
       BBOX_READ,
+      BBOX_LATCH,
       FIFO_RESET,
       PERF_QUERY,
       DO_SAVE_STATE,
@@ -63,6 +64,10 @@ public:
         u16* data;
       } bbox;
 
+      struct
+      {
+      } bbox_latch;
+
       struct
       {
       } fifo_reset;
@@ -95,6 +100,7 @@ public:
 private:
   void PullEventsInternal();
   void HandleEvent(const Event& e);
+  void DropEvent(const Event& e);
 
   static AsyncRequests s_singleton;
 
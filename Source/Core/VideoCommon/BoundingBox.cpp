@@ -91,6 +91,38 @@ void BoundingBox::Set(u32 index, u16 value)
   m_dirty[index] = true;
 }
 
+void BoundingBox::Latch()
+{
+  u64 values = 0;
+  for (u32 i = 0; i < NUM_BBOX_VALUES; i++)
+    values |= u64{Get(i)} << (i * 16);
+
+  m_latched_values.store(values, std::memory_order_relaxed);
+  m_latch_pending.store(false, std::memory_order_relaxed);
+}
+
+bool BoundingBox::BeginLatchedRead(u32 index)
+{
+  ASSERT(index < NUM_BBOX_VALUES);
+
+  const u32 bit = 1u << index;
+  const bool new_round = (m_read_mask & bit) != 0;
+  if (new_round)
+  {
+    m_read_values = m_latched_values.load(std::memory_order_relaxed);
+    m_read_mask = 0;
+  }
+  m_read_mask |= bit;
+  return new_round;
+}
+
+u16 BoundingBox::GetLatched(u32 index) const
+{
+  ASSERT(index < NUM_BBOX_VALUES);
+
+  return static_cast<u16>(m_read_values >> (index * 16));
+}
+
 // FIXME: This may not work correctly if we're in the middle of a draw.
 // We should probably ensure that state saves only happen on frame boundaries.
 // Nonetheless, it has been designed to be as safe as possible.
@@ -110,6 +142,18 @@ void BoundingBox::DoState(PointerWrap& p)
 
     if (g_ActiveConfig.backend_info.bSupportsBBox)
       Write(0, backend_values);
+
+    // The latched values aren't part of the state. Start over from the loaded values, since any
+    // latch that was requested before loading won't happen anymore.
+    u64 latched_values = 0;
+    for (u32 i = 0; i < NUM_BBOX_VALUES; i++)
+    {
+      const BBoxType value = m_is_valid || m_dirty[i] ? m_values[i] : backend_values[i];
+      latched_values |= u64{static_cast<u16>(value)} << (i * 16);
+    }
+    m_latched_values.store(latched_values, std::memory_order_relaxed);
+    m_read_mask = ALL_LATCHED_VALUES_READ;
+    CancelLatch();
   }
   else
   {
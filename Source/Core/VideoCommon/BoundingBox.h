@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <vector>
 
 #include "Common/CommonTypes.h"
@@ -28,6 +29,18 @@ public:
   u16 Get(u32 index);
   void Set(u32 index, u16 value);
 
+  // Deferred readback. The CPU thread is handed the values of the last latch, and requests a new
+  // one which the GPU thread performs when it gets to it. RequestLatch returns false if a latch is
+  // already pending. CancelLatch must be called if a requested latch won't be performed.
+  bool RequestLatch() { return !m_latch_pending.exchange(true, std::memory_order_relaxed); }
+  void CancelLatch() { m_latch_pending.store(false, std::memory_order_relaxed); }
+  void Latch();
+  // Called by the CPU thread before reading a latched value. All values of one round of reads come
+  // from the same latch; a round ends when an index is read again. Returns true if this read
+  // starts a new round, which is when the next latch should be requested.
+  bool BeginLatchedRead(u32 index);
+  u16 GetLatched(u32 index) const;
+
   void DoState(PointerWrap& p);
 
   // Initialize, Read, and Write are only safe to call if the backend supports bounding box,
@@ -47,4 +60,13 @@ private:
   std::array<BBoxType, NUM_BBOX_VALUES> m_values = {};
   std::array<bool, NUM_BBOX_VALUES> m_dirty = {};
   bool m_is_valid = true;
+
+  static constexpr u32 ALL_LATCHED_VALUES_READ = (1 << NUM_BBOX_VALUES) - 1;
+
+  // All four values are packed into one word so that a latch is published as a unit.
+  std::atomic<u64> m_latched_values = 0;
+  std::atomic<bool> m_latch_pending = false;
+  // CPU thread only.
+  u64 m_read_values = 0;
+  u32 m_read_mask = ALL_LATCHED_VALUES_READ;
 };
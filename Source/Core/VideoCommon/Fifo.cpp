@@ -3,9 +3,11 @@
 
 #include "VideoCommon/Fifo.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cstring>
 
+#include "Common/Align.h"
 #include "Common/Assert.h"
 #include "Common/BlockingLoop.h"
 #include "Common/ChunkFile.h"
@@ -35,6 +37,10 @@ namespace Fifo
 {
 static constexpr u32 FIFO_SIZE = 2 * 1024 * 1024;
 static constexpr int GPU_TIME_SLOT_SIZE = 1000;
+// Upper bound on how much FIFO data the GPU thread consumes before checking for events from the
+// CPU thread again. This is lower with SyncGPU, so that the tick budget is checked regularly.
+static constexpr u32 MAX_FIFO_READ_SIZE = 256 * GPFifo::GATHER_PIPE_SIZE;
+static constexpr u32 MAX_FIFO_READ_SIZE_SYNC_GPU = 16 * GPFifo::GATHER_PIPE_SIZE;
 
 static Common::BlockingLoop s_gpu_mainloop;
 
@@ -248,16 +254,15 @@ void* PopFifoAuxBuffer(size_t size)
 }
 
 // Description: RunGpuLoop() sends data through this function.
-static void ReadDataFromFifo(u32 readPtr)
+static void ReadDataFromFifo(u32 readPtr, u32 size)
 {
-  if (GPFifo::GATHER_PIPE_SIZE >
-      static_cast<size_t>(s_video_buffer + FIFO_SIZE - s_video_buffer_write_ptr))
+  if (size > static_cast<size_t>(s_video_buffer + FIFO_SIZE - s_video_buffer_write_ptr))
   {
     const size_t existing_len = s_video_buffer_write_ptr - s_video_buffer_read_ptr;
-    if (GPFifo::GATHER_PIPE_SIZE > static_cast<size_t>(FIFO_SIZE - existing_len))
+    if (size > static_cast<size_t>(FIFO_SIZE - existing_len))
     {
-      PanicAlertFmt("FIFO out of bounds (existing {} + new {} > {})", existing_len,
-                    GPFifo::GATHER_PIPE_SIZE, FIFO_SIZE);
+      PanicAlertFmt("FIFO out of bounds (existing {} + new {} > {})", existing_len, size,
+                    FIFO_SIZE);
       return;
     }
     memmove(s_video_buffer, s_video_buffer_read_ptr, existing_len);
@@ -265,8 +270,46 @@ static void ReadDataFromFifo(u32 readPtr)
     s_video_buffer_read_ptr = s_video_buffer;
   }
   // Copy new video instructions to s_video_buffer for future use in rendering the new picture
-  Memory::CopyFromEmu(s_video_buffer_write_ptr, readPtr, GPFifo::GATHER_PIPE_SIZE);
-  s_video_buffer_write_ptr += GPFifo::GATHER_PIPE_SIZE;
+  Memory::CopyFromEmu(s_video_buffer_write_ptr, readPtr, size);
+  s_video_buffer_write_ptr += size;
+}
+
+// Returns how much of the FIFO the GPU thread can read starting at readPtr in one go. This is
+// limited to the data before the FIFO wraps around, and stops at every point where the CP status
+// update after a gather pipe sized chunk could hit a breakpoint or raise or clear a watermark
+// interrupt, so that interrupts are raised at the same read pointer as when reading chunk by chunk.
+static u32 GetFifoReadSize(u32 readPtr, u32 distance)
+{
+  const CommandProcessor::SCPFifoStruct& fifo = CommandProcessor::fifo;
+  u32 size =
+      std::min(distance, s_config_sync_gpu ? MAX_FIFO_READ_SIZE_SYNC_GPU : MAX_FIFO_READ_SIZE);
+
+  const u32 end = fifo.CPEnd.load(std::memory_order_relaxed);
+  if (readPtr <= end)
+    size = std::min(size, end - readPtr + GPFifo::GATHER_PIPE_SIZE);
+
+  if (fifo.bFF_BPEnable.load(std::memory_order_relaxed))
+  {
+    const u32 breakpoint = fifo.CPBreakpoint.load(std::memory_order_relaxed);
+    if (breakpoint > readPtr && breakpoint - readPtr < size)
+      size = breakpoint - readPtr;
+  }
+
+  // The distance goes below the high watermark once the first chunk that gets it there has been
+  // read, and below the low watermark the same way.
+  const auto limit_to_crossing = [&](u32 watermark, bool above) {
+    if (distance > watermark || (!above && distance == watermark))
+    {
+      const u32 crossing = above ? distance - watermark : distance - watermark + 1;
+      size = std::min(size, Common::AlignUp(crossing, GPFifo::GATHER_PIPE_SIZE));
+    }
+  };
+  if (fifo.bFF_HiWatermarkInt.load(std::memory_order_relaxed))
+    limit_to_crossing(fifo.CPHiWatermark, true);
+  if (fifo.bFF_LoWatermarkInt.load(std::memory_order_relaxed))
+    limit_to_crossing(fifo.CPLoWatermark, false);
+
+  return std::max(Common::AlignDown(size, GPFifo::GATHER_PIPE_SIZE), GPFifo::GATHER_PIPE_SIZE);
 }
 
 // The deterministic_gpu_thread version.
@@ -357,10 +400,14 @@ void RunGpuLoop()
             if (s_config_sync_gpu && s_sync_ticks.load() < s_config_sync_gpu_min_distance)
               break;
 
+            // Read all the data that is available in one go, instead of a chunk at a time.
             u32 cyclesExecuted = 0;
             u32 readPtr = fifo.CPReadPointer.load(std::memory_order_relaxed);
-            ReadDataFromFifo(readPtr);
+            const u32 read_size = GetFifoReadSize(
+                readPtr, fifo.CPReadWriteDistance.load(std::memory_order_relaxed));
+            ReadDataFromFifo(readPtr, read_size);
 
+            readPtr += read_size - GPFifo::GATHER_PIPE_SIZE;
             if (readPtr == fifo.CPEnd.load(std::memory_order_relaxed))
               readPtr = fifo.CPBase.load(std::memory_order_relaxed);
             else
@@ -368,7 +415,7 @@ void RunGpuLoop()
 
             const s32 distance =
                 static_cast<s32>(fifo.CPReadWriteDistance.load(std::memory_order_relaxed)) -
-                GPFifo::GATHER_PIPE_SIZE;
+                static_cast<s32>(read_size);
             ASSERT_MSG(COMMANDPROCESSOR, distance >= 0,
                        "Negative fifo.CPReadWriteDistance = {} in FIFO Loop !\nThat can produce "
                        "instability in the game. Please report it.",
@@ -379,7 +426,7 @@ void RunGpuLoop()
                 DataReader(s_video_buffer_read_ptr, write_ptr), &cyclesExecuted);
 
             fifo.CPReadPointer.store(readPtr, std::memory_order_relaxed);
-            fifo.CPReadWriteDistance.fetch_sub(GPFifo::GATHER_PIPE_SIZE, std::memory_order_seq_cst);
+            fifo.CPReadWriteDistance.fetch_sub(read_size, std::memory_order_seq_cst);
             if ((write_ptr - s_video_buffer_read_ptr) == 0)
             {
               fifo.SafeCPReadPointer.store(fifo.CPReadPointer.load(std::memory_order_relaxed),
@@ -487,7 +534,8 @@ static int RunGpuOnCpu(int ticks)
         FPURoundMode::LoadDefaultSIMDState();
         reset_simd_state = true;
       }
-      ReadDataFromFifo(fifo.CPReadPointer.load(std::memory_order_relaxed));
+      ReadDataFromFifo(fifo.CPReadPointer.load(std::memory_order_relaxed),
+                       GPFifo::GATHER_PIPE_SIZE);
       u32 cycles = 0;
       s_video_buffer_read_ptr = OpcodeDecoder::RunFifo(
           DataReader(s_video_buffer_read_ptr, s_video_buffer_write_ptr), &cycles);
@@ -416,6 +416,7 @@ u32 FramebufferManager::PeekEFBColor(u32 x, u32 y)
   u32 tile_index;
   if (!IsEFBCacheTilePresent(false, x, y, &tile_index))
     PopulateEFBCache(false, tile_index);
+  RecordEFBCacheAccess(false, tile_index);
 
   u32 value;
   m_efb_color_cache.readback_texture->ReadTexel(x, y, &value);
@@ -431,12 +432,63 @@ float FramebufferManager::PeekEFBDepth(u32 x, u32 y)
   u32 tile_index;
   if (!IsEFBCacheTilePresent(true, x, y, &tile_index))
     PopulateEFBCache(true, tile_index);
+  RecordEFBCacheAccess(true, tile_index);
 
   float value;
   m_efb_depth_cache.readback_texture->ReadTexel(x, y, &value);
   return value;
 }
 
+void FramebufferManager::RecordEFBCacheAccess(bool depth, u32 tile_index)
+{
+  // Some games peek at thousands of pixels, but they only need to be recorded once per tile.
+  constexpr size_t MAX_ACCESSES_PER_FRAME = 256;
+  if (!g_ActiveConfig.bEFBAccessPrefetch || m_efb_cache_accesses.size() >= MAX_ACCESSES_PER_FRAME)
+    return;
+
+  const u32 draw_counter = g_vertex_manager->GetDrawCounter();
+  for (auto it = m_efb_cache_accesses.rbegin();
+       it != m_efb_cache_accesses.rend() && it->draw_counter == draw_counter; ++it)
+  {
+    if (it->depth == depth && it->tile_index == tile_index)
+      return;
+  }
+  m_efb_cache_accesses.push_back({draw_counter, tile_index, depth});
+}
+
+void FramebufferManager::PrefetchEFBCache(u32 draw_counter)
+{
+  bool prefetched = false;
+  for (; m_next_efb_cache_prefetch < m_efb_cache_prefetches.size(); m_next_efb_cache_prefetch++)
+  {
+    const EFBCacheAccess& access = m_efb_cache_prefetches[m_next_efb_cache_prefetch];
+    if (access.draw_counter > draw_counter)
+      break;
+    if (access.draw_counter < draw_counter)
+      continue;
+
+    const EFBCacheData& data = access.depth ? m_efb_depth_cache : m_efb_color_cache;
+    if (data.valid && (!IsUsingTiledEFBCache() || data.tiles[access.tile_index]))
+      continue;
+
+    PopulateEFBCache(access.depth, access.tile_index, true);
+    prefetched = true;
+  }
+
+  // Get the copies started on the GPU, so they are done by the time the CPU asks for them.
+  if (prefetched)
+    g_renderer->Flush();
+}
+
+void FramebufferManager::OnEndFrame()
+{
+  std::swap(m_efb_cache_prefetches, m_efb_cache_accesses);
+  m_efb_cache_accesses.clear();
+  m_next_efb_cache_prefetch = 0;
+  if (!g_ActiveConfig.bEFBAccessPrefetch)
+    m_efb_cache_prefetches.clear();
+}
+
 void FramebufferManager::SetEFBCacheTileSize(u32 size)
 {
   if (m_efb_cache_tile_size == size)
@@ -633,10 +685,11 @@ void FramebufferManager::DestroyReadbackFramebuffer()
   DestroyCache(m_efb_depth_cache);
 }
 
-void FramebufferManager::PopulateEFBCache(bool depth, u32 tile_index)
+void FramebufferManager::PopulateEFBCache(bool depth, u32 tile_index, bool prefetch)
 {
   FlushEFBPokes();
-  g_vertex_manager->OnCPUEFBAccess();
+  if (!prefetch)
+    g_vertex_manager->OnCPUEFBAccess();
 
   // Force the path through the intermediate texture, as we can't do an image copy from a depth
   // buffer directly to a staging texture (must be the whole resource).
@@ -692,8 +745,10 @@ void FramebufferManager::PopulateEFBCache(bool depth, u32 tile_index)
     data.readback_texture->CopyFromTexture(src_texture, rect, 0, 0, rect);
   }
 
-  // Wait until the copy is complete.
-  data.readback_texture->Flush();
+  // Wait until the copy is complete. Reading from or writing to the staging texture waits for any
+  // copies that are still pending, so prefetched tiles are flushed on first access instead.
+  if (!prefetch)
+    data.readback_texture->Flush();
   data.valid = true;
   data.out_of_date = false;
   if (IsUsingTiledEFBCache())
@@ -101,6 +101,11 @@ public:
   void InvalidatePeekCache(bool forced = true);
   void FlagPeekCacheAsOutOfDate();
 
+  // Starts copying back the tiles that were peeked at this point last frame, without waiting for
+  // the copies to finish. Call after each draw with the vertex manager's draw counter.
+  void PrefetchEFBCache(u32 draw_counter);
+  void OnEndFrame();
+
   // Writes a value to the framebuffer. This will never block, and writes will be batched.
   void PokeEFBColor(u32 x, u32 y, u32 color);
   void PokeEFBDepth(u32 x, u32 y, float depth);
@@ -130,6 +135,13 @@ protected:
     bool valid;
   };
 
+  struct EFBCacheAccess
+  {
+    u32 draw_counter;
+    u32 tile_index;
+    bool depth;
+  };
+
   bool CreateEFBFramebuffer();
   void DestroyEFBFramebuffer();
 
@@ -151,7 +163,9 @@ protected:
   bool IsUsingTiledEFBCache() const;
   bool IsEFBCacheTilePresent(bool depth, u32 x, u32 y, u32* tile_index) const;
   MathUtil::Rectangle<int> GetEFBCacheTileRect(u32 tile_index) const;
-  void PopulateEFBCache(bool depth, u32 tile_index);
+  // If prefetch is set, the copy is not waited for; the first read from the tile does that.
+  void PopulateEFBCache(bool depth, u32 tile_index, bool prefetch = false);
+  void RecordEFBCacheAccess(bool depth, u32 tile_index);
 
   void CreatePokeVertices(std::vector<EFBPokeVertex>* destination_list, u32 x, u32 y, float z,
                           u32 color);
@@ -187,6 +201,12 @@ protected:
   EFBCacheData m_efb_color_cache = {};
   EFBCacheData m_efb_depth_cache = {};
 
+  // Tiles peeked at this frame, and the ones from last frame that are still to be prefetched.
+  // Both are sorted by draw counter.
+  std::vector<EFBCacheAccess> m_efb_cache_accesses;
+  std::vector<EFBCacheAccess> m_efb_cache_prefetches;
+  size_t m_next_efb_cache_prefetch = 0;
+
   // EFB clear pipelines
   // Indexed by [color_write_enabled][alpha_write_enabled][depth_write_enabled]
   std::array<std::array<std::array<std::unique_ptr<AbstractPipeline>, 2>, 2>, 2>
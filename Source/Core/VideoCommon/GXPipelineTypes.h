@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "Common/Hash.h"
 #include "VideoCommon/GeometryShaderGen.h"
 #include "VideoCommon/NativeVertexFormat.h"
 #include "VideoCommon/PixelShaderGen.h"
@@ -90,6 +91,34 @@ struct SerializedGXUberPipelineUid
   u32 depth_state_bits = 0;
   u32 blending_state_bits = 0;
 };
+// Entry of the pipeline UID cache file. The usage information is used to decide which pipelines
+// to precompile first.
+struct SerializedGXPipelineUidEntry
+{
+  SerializedGXPipelineUid uid;
+  u32 first_use_frame = 0;
+  u32 hit_count = 0;
+};
 #pragma pack(pop)
 
 }  // namespace VideoCommon
+
+// Pipeline UIDs are compared with memcmp(), so they can be hashed as raw bytes as well.
+template <>
+struct std::hash<VideoCommon::GXPipelineUid>
+{
+  size_t operator()(const VideoCommon::GXPipelineUid& uid) const
+  {
+    return static_cast<size_t>(
+        Common::GetHash64(reinterpret_cast<const u8*>(&uid), sizeof(uid), 0));
+  }
+};
+template <>
+struct std::hash<VideoCommon::GXUberPipelineUid>
+{
+  size_t operator()(const VideoCommon::GXUberPipelineUid& uid) const
+  {
+    return static_cast<size_t>(
+        Common::GetHash64(reinterpret_cast<const u8*>(&uid), sizeof(uid), 0));
+  }
+};
@@ -8,14 +8,145 @@
 #include <cstring>
 
 #include "Common/CommonTypes.h"
+#include "Common/Intrinsics.h"
 #include "Common/Logging/Log.h"
 #include "VideoCommon/OpcodeDecoding.h"
 #include "VideoCommon/VideoConfig.h"
 
+#ifdef _M_ARM_64
+#include <arm_neon.h>
+#endif
+
 namespace
 {
 constexpr u16 s_primitive_restart = UINT16_MAX;
 
+// A run of indices that repeats every few primitives, only offset by the number of vertices
+// those primitives consumed. Lanes that refer to a fixed vertex (the center of a fan) don't
+// advance, and neither do primitive restart lanes.
+template <u32 NumVectors>
+struct IndexPattern
+{
+  static constexpr u32 NUM_INDICES = NumVectors * 8;
+
+  std::array<u16, NUM_INDICES> indices;
+  std::array<u16, NUM_INDICES> steps;
+};
+
+// index(n) gives the n-th index of the unbounded run, relative to the first vertex.
+template <u32 NumVectors, typename Function>
+constexpr IndexPattern<NumVectors> MakeIndexPattern(Function index)
+{
+  IndexPattern<NumVectors> pattern{};
+  for (u32 n = 0; n < pattern.NUM_INDICES; n++)
+  {
+    pattern.indices[n] = static_cast<u16>(index(n));
+    pattern.steps[n] = static_cast<u16>(index(n + pattern.NUM_INDICES) - index(n));
+  }
+  return pattern;
+}
+
+// Writes num_repeats repetitions of the pattern, offset by index. The largest index is 65534
+// (see GetRemainingIndices), so saturating adds leave the restart lanes alone without masking.
+template <u32 NumVectors>
+u16* WritePattern(u16* index_ptr, const IndexPattern<NumVectors>& pattern, u32 num_repeats,
+                  u32 index)
+{
+#if defined(_M_X86)
+  const __m128i base = _mm_set1_epi16(static_cast<s16>(index));
+  __m128i indices[NumVectors];
+  __m128i steps[NumVectors];
+  for (u32 i = 0; i < NumVectors; i++)
+  {
+    indices[i] = _mm_adds_epu16(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(&pattern.indices[i * 8])), base);
+    steps[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&pattern.steps[i * 8]));
+  }
+  for (u32 repeat = 0; repeat < num_repeats; repeat++)
+  {
+    for (u32 i = 0; i < NumVectors; i++)
+    {
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(index_ptr), indices[i]);
+      indices[i] = _mm_adds_epu16(indices[i], steps[i]);
+      index_ptr += 8;
+    }
+  }
+#elif defined(_M_ARM_64)
+  const uint16x8_t base = vdupq_n_u16(static_cast<u16>(index));
+  uint16x8_t indices[NumVectors];
+  uint16x8_t steps[NumVectors];
+  for (u32 i = 0; i < NumVectors; i++)
+  {
+    indices[i] = vqaddq_u16(vld1q_u16(&pattern.indices[i * 8]), base);
+    steps[i] = vld1q_u16(&pattern.steps[i * 8]);
+  }
+  for (u32 repeat = 0; repeat < num_repeats; repeat++)
+  {
+    for (u32 i = 0; i < NumVectors; i++)
+    {
+      vst1q_u16(index_ptr, indices[i]);
+      indices[i] = vqaddq_u16(indices[i], steps[i]);
+      index_ptr += 8;
+    }
+  }
+#else
+  for (u32 repeat = 0; repeat < num_repeats; repeat++)
+  {
+    for (u32 n = 0; n < pattern.NUM_INDICES; n++)
+    {
+      const u16 value = pattern.indices[n];
+      *index_ptr++ =
+          value == s_primitive_restart ? value : value + index + repeat * pattern.steps[n];
+    }
+  }
+#endif
+  return index_ptr;
+}
+
+constexpr auto s_sequential_pattern = MakeIndexPattern<1>([](u32 n) { return n; });
+// 2 triangles per repeat.
+constexpr auto s_list_pr_pattern = MakeIndexPattern<1>(
+    [](u32 n) { return n % 4 == 3 ? s_primitive_restart : n / 4 * 3 + n % 4; });
+// 8 triangles per repeat, with every other triangle's winding flipped.
+constexpr auto s_strip_pattern = MakeIndexPattern<3>([](u32 n) {
+  const u32 triangle = n / 3;
+  const u32 vertex = n % 3;
+  return triangle + (vertex != 0 && triangle % 2 != 0 ? 3 - vertex : vertex);
+});
+// 8 triangles per repeat.
+constexpr auto s_fan_pattern =
+    MakeIndexPattern<3>([](u32 n) { return n % 3 == 0 ? 0 : n / 3 + n % 3; });
+// 4 strips of 3 triangles per repeat.
+constexpr auto s_fan_pr_pattern = MakeIndexPattern<3>([](u32 n) {
+  constexpr std::array<u32, 6> offsets = {1, 2, 0, 3, 4, 0};
+  const u32 i = n % 6;
+  if (i == 5)
+    return u32(s_primitive_restart);
+  return i == 2 ? 0 : n / 6 * 3 + offsets[i];
+});
+// 4 quads per repeat.
+constexpr auto s_quads_pattern = MakeIndexPattern<3>([](u32 n) {
+  constexpr std::array<u32, 6> offsets = {0, 1, 2, 0, 2, 3};
+  return n / 6 * 4 + offsets[n % 6];
+});
+// 8 quads per repeat.
+constexpr auto s_quads_pr_pattern = MakeIndexPattern<5>([](u32 n) {
+  constexpr std::array<u32, 4> offsets = {1, 2, 0, 3};
+  return n % 5 == 4 ? s_primitive_restart : n / 5 * 4 + offsets[n % 5];
+});
+// 4 lines per repeat.
+constexpr auto s_line_strip_pattern = MakeIndexPattern<1>([](u32 n) { return n / 2 + n % 2; });
+
+// Writes count consecutive indices starting at index.
+u16* WriteSequential(u16* index_ptr, u32 count, u32 index)
+{
+  const u32 num_repeats = count / 8;
+  index_ptr = WritePattern(index_ptr, s_sequential_pattern, num_repeats, index);
+  for (u32 i = num_repeats * 8; i < count; ++i)
+    *index_ptr++ = index + i;
+  return index_ptr;
+}
+
 template <bool pr>
 u16* WriteTriangle(u16* index_ptr, u32 index1, u32 index2, u32 index3)
 {
@@ -30,7 +161,13 @@ u16* WriteTriangle(u16* index_ptr, u32 index1, u32 index2, u32 index3)
 template <bool pr>
 u16* AddList(u16* index_ptr, u32 num_verts, u32 index)
 {
-  for (u32 i = 2; i < num_verts; i += 3)
+  const u32 num_triangles = num_verts / 3;
+  if constexpr (!pr)
+    return WriteSequential(index_ptr, num_triangles * 3, index);
+
+  const u32 num_repeats = num_triangles / 2;
+  index_ptr = WritePattern(index_ptr, s_list_pr_pattern, num_repeats, index);
+  for (u32 i = num_repeats * 6 + 2; i < num_verts; i += 3)
   {
     index_ptr = WriteTriangle<pr>(index_ptr, index + i - 2, index + i - 1, index + i);
   }
@@ -42,16 +179,17 @@ u16* AddStrip(u16* index_ptr, u32 num_verts, u32 index)
 {
   if constexpr (pr)
   {
-    for (u32 i = 0; i < num_verts; ++i)
-    {
-      *index_ptr++ = index + i;
-    }
+    index_ptr = WriteSequential(index_ptr, num_verts, index);
     *index_ptr++ = s_primitive_restart;
   }
   else
   {
+    const u32 num_repeats = num_verts > 2 ? (num_verts - 2) / 8 : 0;
+    index_ptr = WritePattern(index_ptr, s_strip_pattern, num_repeats, index);
+
+    // Each repeat covers an even number of triangles, so the winding starts over.
     bool wind = false;
-    for (u32 i = 2; i < num_verts; ++i)
+    for (u32 i = num_repeats * 8 + 2; i < num_verts; ++i)
     {
       index_ptr = WriteTriangle<pr>(index_ptr, index + i - 2, index + i - !wind, index + i - wind);
 
@@ -87,6 +225,10 @@ u16* AddFan(u16* index_ptr, u32 num_verts, u32 index)
 
   if constexpr (pr)
   {
+    const u32 num_repeats = num_verts > 2 ? (num_verts - 2) / 12 : 0;
+    index_ptr = WritePattern(index_ptr, s_fan_pr_pattern, num_repeats, index);
+    i += num_repeats * 12;
+
     for (; i + 3 <= num_verts; i += 3)
     {
       *index_ptr++ = index + i - 1;
@@ -106,6 +248,12 @@ u16* AddFan(u16* index_ptr, u32 num_verts, u32 index)
       *index_ptr++ = s_primitive_restart;
     }
   }
+  else
+  {
+    const u32 num_repeats = num_verts > 2 ? (num_verts - 2) / 8 : 0;
+    index_ptr = WritePattern(index_ptr, s_fan_pattern, num_repeats, index);
+    i += num_repeats * 8;
+  }
 
   for (; i < num_verts; ++i)
   {
@@ -134,7 +282,14 @@ u16* AddFan(u16* index_ptr, u32 num_verts, u32 index)
 template <bool pr>
 u16* AddQuads(u16* index_ptr, u32 num_verts, u32 index)
 {
-  u32 i = 3;
+  constexpr u32 quads_per_repeat = pr ? 8 : 4;
+  const u32 num_repeats = num_verts / 4 / quads_per_repeat;
+  if constexpr (pr)
+    index_ptr = WritePattern(index_ptr, s_quads_pr_pattern, num_repeats, index);
+  else
+    index_ptr = WritePattern(index_ptr, s_quads_pattern, num_repeats, index);
+
+  u32 i = num_repeats * quads_per_repeat * 4 + 3;
   for (; i < num_verts; i += 4)
   {
     if constexpr (pr)
@@ -170,19 +325,16 @@ u16* AddQuads_nonstandard(u16* index_ptr, u32 num_verts, u32 index)
 
 u16* AddLineList(u16* index_ptr, u32 num_verts, u32 index)
 {
-  for (u32 i = 1; i < num_verts; i += 2)
-  {
-    *index_ptr++ = index + i - 1;
-    *index_ptr++ = index + i;
-  }
-  return index_ptr;
+  return WriteSequential(index_ptr, num_verts / 2 * 2, index);
 }
 
 // Shouldn't be used as strips as LineLists are much more common
 // so converting them to lists
 u16* AddLineStrip(u16* index_ptr, u32 num_verts, u32 index)
 {
-  for (u32 i = 1; i < num_verts; ++i)
+  const u32 num_repeats = num_verts > 1 ? (num_verts - 1) / 4 : 0;
+  index_ptr = WritePattern(index_ptr, s_line_strip_pattern, num_repeats, index);
+  for (u32 i = num_repeats * 4 + 1; i < num_verts; ++i)
   {
     *index_ptr++ = index + i - 1;
     *index_ptr++ = index + i;
@@ -192,11 +344,7 @@ u16* AddLineStrip(u16* index_ptr, u32 num_verts, u32 index)
 
 u16* AddPoints(u16* index_ptr, u32 num_verts, u32 index)
 {
-  for (u32 i = 0; i != num_verts; ++i)
-  {
-    *index_ptr++ = index + i;
-  }
-  return index_ptr;
+  return WriteSequential(index_ptr, num_verts, index);
 }
 }  // Anonymous namespace
 
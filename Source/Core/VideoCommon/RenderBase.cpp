@@ -254,6 +254,37 @@ void Renderer::BBoxFlush()
   m_bounding_box->Flush();
 }
 
+bool Renderer::BBoxRequestLatch()
+{
+  return m_bounding_box->RequestLatch();
+}
+
+void Renderer::BBoxCancelLatch()
+{
+  m_bounding_box->CancelLatch();
+}
+
+void Renderer::BBoxLatch()
+{
+  if (!g_ActiveConfig.bBBoxEnable || !g_ActiveConfig.backend_info.bSupportsBBox)
+  {
+    m_bounding_box->CancelLatch();
+    return;
+  }
+
+  m_bounding_box->Latch();
+}
+
+bool Renderer::BBoxBeginLatchedRead(u32 index)
+{
+  return m_bounding_box->BeginLatchedRead(index);
+}
+
+u16 Renderer::BBoxReadLatched(u32 index) const
+{
+  return m_bounding_box->GetLatched(index);
+}
+
 u32 Renderer::AccessEFB(EFBAccessType type, u32 x, u32 y, u32 poke_data)
 {
   if (type == EFBAccessType::PeekColor)
@@ -1423,6 +1454,7 @@ void Renderer::Swap(u32 xfb_addr, u32 fb_width, u32 fb_stride, u32 fb_height, u6
 
       g_shader_cache->RetrieveAsyncShaders();
       g_vertex_manager->OnEndFrame();
+      g_framebuffer_manager->OnEndFrame();
       BeginImGuiFrame();
 
       // We invalidate the pipeline object at the start of the frame.
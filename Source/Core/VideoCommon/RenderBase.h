@@ -148,6 +148,7 @@ public:
   int GetBackbufferWidth() const { return m_backbuffer_width; }
   int GetBackbufferHeight() const { return m_backbuffer_height; }
   float GetBackbufferScale() const { return m_backbuffer_scale; }
+  int GetFrameCount() const { return m_frame_count; }
   void SetWindowSize(int width, int height);
 
   // Sets viewport and scissor to the specified rectangle. rect is assumed to be in framebuffer
@@ -221,6 +222,12 @@ public:
   u16 BBoxRead(u32 index);
   void BBoxWrite(u32 index, u16 value);
   void BBoxFlush();
+  // Deferred readback, see BoundingBox::RequestLatch.
+  bool BBoxRequestLatch();
+  void BBoxCancelLatch();
+  void BBoxLatch();
+  bool BBoxBeginLatchedRead(u32 index);
+  u16 BBoxReadLatched(u32 index) const;
 
   virtual void Flush() {}
   virtual void WaitForGPUIdle() {}
@@ -3,6 +3,9 @@
 
 #include "VideoCommon/ShaderCache.h"
 
+#include <algorithm>
+#include <limits>
+
 #include <fmt/format.h>
 
 #include "Common/Assert.h"
@@ -112,9 +115,13 @@ void ShaderCache::Shutdown()
 
 const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid)
 {
+  if (m_last_gx_pipeline && m_last_gx_pipeline_uid == uid)
+    return m_last_gx_pipeline;
+
+  RecordGXPipelineUse(uid);
   auto it = m_gx_pipeline_cache.find(uid);
   if (it != m_gx_pipeline_cache.end() && !it->second.second)
-    return it->second.first.get();
+    return SetLastGXPipeline(uid, it->second.first.get());
 
   const bool exists_in_cache = it != m_gx_pipeline_cache.end();
   std::unique_ptr<AbstractPipeline> pipeline;
@@ -123,17 +130,21 @@ const AbstractPipeline* ShaderCache::GetPipelineForUid(const GXPipelineUid& uid)
     pipeline = g_renderer->CreatePipeline(*pipeline_config);
   if (g_ActiveConfig.bShaderCache && !exists_in_cache)
     AppendGXPipelineUID(uid);
-  return InsertGXPipeline(uid, std::move(pipeline));
+  return SetLastGXPipeline(uid, InsertGXPipeline(uid, std::move(pipeline)));
 }
 
 std::optional<const AbstractPipeline*> ShaderCache::GetPipelineForUidAsync(const GXPipelineUid& uid)
 {
+  if (m_last_gx_pipeline && m_last_gx_pipeline_uid == uid)
+    return m_last_gx_pipeline;
+
+  RecordGXPipelineUse(uid);
   auto it = m_gx_pipeline_cache.find(uid);
   if (it != m_gx_pipeline_cache.end())
   {
     // .second is the pending flag, i.e. compiling in the background.
     if (!it->second.second)
-      return it->second.first.get();
+      return SetLastGXPipeline(uid, it->second.first.get());
     else
       return {};
   }
@@ -156,6 +167,19 @@ const AbstractPipeline* ShaderCache::GetUberPipelineForUid(const GXUberPipelineU
   return InsertGXUberPipeline(uid, std::move(pipeline));
 }
 
+const AbstractPipeline* ShaderCache::SetLastGXPipeline(const GXPipelineUid& uid,
+                                                       const AbstractPipeline* pipeline)
+{
+  // Null pipelines may still be compiled later on (e.g. UIDs from the UID cache), so only
+  // remember actual pipelines. These are never replaced until the caches are cleared.
+  if (pipeline)
+  {
+    m_last_gx_pipeline_uid = uid;
+    m_last_gx_pipeline = pipeline;
+  }
+  return pipeline;
+}
+
 void ShaderCache::WaitForAsyncCompiler()
 {
   bool running = true;
@@ -382,6 +406,7 @@ void ShaderCache::LoadCaches()
 
 void ShaderCache::ClearCaches()
 {
+  m_last_gx_pipeline = nullptr;
   ClearPipelineCache(m_gx_pipeline_cache, m_gx_pipeline_disk_cache);
   ClearShaderCache(m_vs_cache);
   ClearShaderCache(m_gs_cache);
@@ -416,10 +441,18 @@ void ShaderCache::ClearCaches()
 
 void ShaderCache::CompileMissingPipelines()
 {
-  // Queue all uids with a null pipeline for compilation.
+  // Queue all uids with a null pipeline for compilation. Work items with the same priority are
+  // compiled in the order they are queued, so queue the pipelines that were needed first in
+  // previous sessions first, followed by any that don't have usage information.
+  for (const GXPipelineUid& uid : GetGXPipelineUIDsByUsage())
+  {
+    auto it = m_gx_pipeline_cache.find(uid);
+    if (it != m_gx_pipeline_cache.end() && !it->second.first && !it->second.second)
+      QueuePipelineCompile(uid, COMPILE_PRIORITY_SHADERCACHE_PIPELINE);
+  }
   for (auto& it : m_gx_pipeline_cache)
   {
-    if (!it.second.first)
+    if (!it.second.first && !it.second.second)
       QueuePipelineCompile(it.first, COMPILE_PRIORITY_SHADERCACHE_PIPELINE);
   }
   for (auto& it : m_gx_uber_pipeline_cache)
@@ -852,10 +885,14 @@ ShaderCache::InsertGXUberPipeline(const GXUberPipelineUid& config,
   return entry.first.get();
 }
 
+// Version 1 of the UID cache only stored the UIDs, in the order the pipelines were first used.
+// Version 2 stores the usage of each pipeline along with it.
+constexpr u32 PIPELINE_UID_CACHE_MAGIC_V1 = 0x44495550;  // PUID
+constexpr u32 PIPELINE_UID_CACHE_MAGIC = 0x32495550;     // PUI2
+constexpr size_t PIPELINE_UID_CACHE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
+
 void ShaderCache::LoadPipelineUIDCache()
 {
-  constexpr u32 CACHE_FILE_MAGIC = 0x44495550;  // PUID
-  constexpr size_t CACHE_HEADER_SIZE = sizeof(u32) + sizeof(u32);
   std::string filename =
       File::GetUserPath(D_CACHE_IDX) + SConfig::GetInstance().GetGameID() + ".uidcache";
   if (m_gx_pipeline_uid_cache_file.Open(filename, "rb+"))
@@ -864,27 +901,37 @@ void ShaderCache::LoadPipelineUIDCache()
     u32 existing_magic;
     u32 existing_version;
     bool uid_file_valid = false;
+    bool uid_file_outdated = false;
     if (m_gx_pipeline_uid_cache_file.ReadBytes(&existing_magic, sizeof(existing_magic)) &&
         m_gx_pipeline_uid_cache_file.ReadBytes(&existing_version, sizeof(existing_version)) &&
-        existing_magic == CACHE_FILE_MAGIC && existing_version == GX_PIPELINE_UID_VERSION)
+        (existing_magic == PIPELINE_UID_CACHE_MAGIC ||
+         existing_magic == PIPELINE_UID_CACHE_MAGIC_V1) &&
+        existing_version == GX_PIPELINE_UID_VERSION)
     {
+      uid_file_outdated = existing_magic == PIPELINE_UID_CACHE_MAGIC_V1;
+      const size_t entry_size = uid_file_outdated ? sizeof(SerializedGXPipelineUid) :
+                                                    sizeof(SerializedGXPipelineUidEntry);
+
       // Ensure the expected size matches the actual size of the file. If it doesn't, it means
       // the cache file may be corrupted, and we should not proceed with loading potentially
       // garbage or invalid UIDs.
       const u64 file_size = m_gx_pipeline_uid_cache_file.GetSize();
       const size_t uid_count =
-          static_cast<size_t>(file_size - CACHE_HEADER_SIZE) / sizeof(SerializedGXPipelineUid);
-      const size_t expected_size = uid_count * sizeof(SerializedGXPipelineUid) + CACHE_HEADER_SIZE;
+          static_cast<size_t>(file_size - PIPELINE_UID_CACHE_HEADER_SIZE) / entry_size;
+      const size_t expected_size = uid_count * entry_size + PIPELINE_UID_CACHE_HEADER_SIZE;
       uid_file_valid = file_size == expected_size;
       if (uid_file_valid)
       {
         for (size_t i = 0; i < uid_count; i++)
         {
-          SerializedGXPipelineUid serialized_uid;
-          if (m_gx_pipeline_uid_cache_file.ReadBytes(&serialized_uid, sizeof(serialized_uid)))
+          // Old entries don't have any usage information, so order them the way they were
+          // written, which is the order they were first used in.
+          SerializedGXPipelineUidEntry entry;
+          entry.first_use_frame = static_cast<u32>(i);
+          if (m_gx_pipeline_uid_cache_file.ReadBytes(&entry, entry_size))
           {
             // This just adds the pipeline to the map, it is compiled later.
-            AddSerializedGXPipelineUID(serialized_uid);
+            AddSerializedGXPipelineUID(entry);
           }
           else
           {
@@ -899,8 +946,8 @@ void ShaderCache::LoadPipelineUIDCache()
         uid_file_valid = m_gx_pipeline_uid_cache_file.Seek(expected_size, File::SeekOrigin::Begin);
     }
 
-    // If the file is invalid, close it. We re-open and truncate it below.
-    if (!uid_file_valid)
+    // If the file is invalid or in the old format, close it. We re-open and truncate it below.
+    if (!uid_file_valid || uid_file_outdated)
       m_gx_pipeline_uid_cache_file.Close();
   }
 
@@ -910,15 +957,15 @@ void ShaderCache::LoadPipelineUIDCache()
     if (m_gx_pipeline_uid_cache_file.Open(filename, "wb"))
     {
       // Write the version identifier.
-      m_gx_pipeline_uid_cache_file.WriteBytes(&CACHE_FILE_MAGIC, sizeof(GX_PIPELINE_UID_VERSION));
+      m_gx_pipeline_uid_cache_file.WriteBytes(&PIPELINE_UID_CACHE_MAGIC,
+                                              sizeof(PIPELINE_UID_CACHE_MAGIC));
       m_gx_pipeline_uid_cache_file.WriteBytes(&GX_PIPELINE_UID_VERSION,
                                               sizeof(GX_PIPELINE_UID_VERSION));
 
       // Write any current UIDs out to the file.
       // This way, if we load a UID cache where the data was incomplete (e.g. Dolphin crashed),
       // we don't lose the existing UIDs which were previously at the beginning.
-      for (const auto& it : m_gx_pipeline_cache)
-        AppendGXPipelineUID(it.first);
+      WritePipelineUIDEntries();
     }
   }
 
@@ -927,22 +974,75 @@ void ShaderCache::LoadPipelineUIDCache()
 
 void ShaderCache::ClosePipelineUIDCache()
 {
-  // This is left as a method in case we need to append extra data to the file in the future.
+  // Entries are appended with the usage at the time the pipeline was first used, so rewrite all
+  // of them with the usage of this session.
+  if (m_gx_pipeline_uid_cache_file.IsOpen() &&
+      m_gx_pipeline_uid_cache_file.Seek(PIPELINE_UID_CACHE_HEADER_SIZE, File::SeekOrigin::Begin))
+  {
+    WritePipelineUIDEntries();
+    m_gx_pipeline_uid_cache_file.Flush();
+    m_gx_pipeline_uid_cache_file.Resize(m_gx_pipeline_uid_cache_file.Tell());
+  }
+
   m_gx_pipeline_uid_cache_file.Close();
 }
 
-void ShaderCache::AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid)
+void ShaderCache::WritePipelineUIDEntries()
+{
+  // Pipelines which were only loaded from the pipeline cache don't have any usage, and are
+  // written after all of the others.
+  for (const auto& it : m_gx_pipeline_cache)
+    m_gx_pipeline_usage.try_emplace(it.first);
+
+  for (const GXPipelineUid& uid : GetGXPipelineUIDsByUsage())
+    AppendGXPipelineUID(uid);
+}
+
+std::vector<GXPipelineUid> ShaderCache::GetGXPipelineUIDsByUsage() const
+{
+  std::vector<std::pair<GXPipelineUid, GXPipelineUsage>> entries(m_gx_pipeline_usage.begin(),
+                                                                 m_gx_pipeline_usage.end());
+  std::sort(entries.begin(), entries.end(), [](const auto& lhs, const auto& rhs) {
+    if (lhs.second.first_use_frame != rhs.second.first_use_frame)
+      return lhs.second.first_use_frame < rhs.second.first_use_frame;
+    return lhs.second.hit_count > rhs.second.hit_count;
+  });
+
+  std::vector<GXPipelineUid> uids;
+  uids.reserve(entries.size());
+  for (const auto& entry : entries)
+    uids.push_back(entry.first);
+  return uids;
+}
+
+void ShaderCache::RecordGXPipelineUse(const GXPipelineUid& uid)
+{
+  if (!m_gx_pipeline_uid_cache_file.IsOpen())
+    return;
+
+  GXPipelineUsage& usage = m_gx_pipeline_usage[uid];
+  usage.first_use_frame =
+      std::min(usage.first_use_frame, static_cast<u32>(g_renderer->GetFrameCount()));
+  if (usage.hit_count != std::numeric_limits<u32>::max())
+    usage.hit_count++;
+}
+
+void ShaderCache::AddSerializedGXPipelineUID(const SerializedGXPipelineUidEntry& entry)
 {
   GXPipelineUid real_uid;
-  UnserializePipelineUid(uid, real_uid);
+  UnserializePipelineUid(entry.uid, real_uid);
+
+  GXPipelineUsage& usage = m_gx_pipeline_usage[real_uid];
+  usage.first_use_frame = std::min(usage.first_use_frame, entry.first_use_frame);
+  usage.hit_count = std::max(usage.hit_count, entry.hit_count);
 
   auto iter = m_gx_pipeline_cache.find(real_uid);
   if (iter != m_gx_pipeline_cache.end())
     return;
 
   // Flag it as empty with a null pipeline object, for later compilation.
-  auto& entry = m_gx_pipeline_cache[real_uid];
-  entry.second = false;
+  auto& entry_in_cache = m_gx_pipeline_cache[real_uid];
+  entry_in_cache.second = false;
 }
 
 void ShaderCache::AppendGXPipelineUID(const GXPipelineUid& config)
@@ -950,9 +1050,16 @@ void ShaderCache::AppendGXPipelineUID(const GXPipelineUid& config)
   if (!m_gx_pipeline_uid_cache_file.IsOpen())
     return;
 
-  SerializedGXPipelineUid disk_uid;
-  SerializePipelineUid(config, disk_uid);
-  if (!m_gx_pipeline_uid_cache_file.WriteBytes(&disk_uid, sizeof(disk_uid)))
+  SerializedGXPipelineUidEntry disk_entry;
+  SerializePipelineUid(config, disk_entry.uid);
+  const auto usage = m_gx_pipeline_usage.find(config);
+  if (usage != m_gx_pipeline_usage.end())
+  {
+    disk_entry.first_use_frame = usage->second.first_use_frame;
+    disk_entry.hit_count = usage->second.hit_count;
+  }
+
+  if (!m_gx_pipeline_uid_cache_file.WriteBytes(&disk_entry, sizeof(disk_entry)))
   {
     WARN_LOG_FMT(VIDEO, "Writing pipeline UID to cache failed, closing file.");
     m_gx_pipeline_uid_cache_file.Close();
@@ -6,12 +6,14 @@
 #include <array>
 #include <cstddef>
 #include <cstring>
+#include <limits>
 #include <map>
 #include <memory>
 #include <optional>
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/IOFile.h"
@@ -154,12 +156,17 @@ private:
                       const BlendingState& blending_state);
   std::optional<AbstractPipelineConfig> GetGXPipelineConfig(const GXPipelineUid& uid);
   std::optional<AbstractPipelineConfig> GetGXPipelineConfig(const GXUberPipelineUid& uid);
+  const AbstractPipeline* SetLastGXPipeline(const GXPipelineUid& uid,
+                                            const AbstractPipeline* pipeline);
   const AbstractPipeline* InsertGXPipeline(const GXPipelineUid& config,
                                            std::unique_ptr<AbstractPipeline> pipeline);
   const AbstractPipeline* InsertGXUberPipeline(const GXUberPipelineUid& config,
                                                std::unique_ptr<AbstractPipeline> pipeline);
-  void AddSerializedGXPipelineUID(const SerializedGXPipelineUid& uid);
+  void AddSerializedGXPipelineUID(const SerializedGXPipelineUidEntry& entry);
   void AppendGXPipelineUID(const GXPipelineUid& config);
+  void WritePipelineUIDEntries();
+  void RecordGXPipelineUse(const GXPipelineUid& uid);
+  std::vector<GXPipelineUid> GetGXPipelineUIDsByUsage() const;
 
   // ASync Compiler Methods
   void QueueVertexShaderCompile(const VertexShaderUid& uid, u32 priority);
@@ -214,7 +221,7 @@ private:
       std::unique_ptr<AbstractShader> shader;
       bool pending = false;
     };
-    std::map<Uid, Shader> shader_map;
+    std::unordered_map<Uid, Shader> shader_map;
     LinearDiskCache<Uid, u8> disk_cache;
   };
   ShaderModuleCache<VertexShaderUid> m_vs_cache;
@@ -224,10 +231,23 @@ private:
   ShaderModuleCache<UberShader::PixelShaderUid> m_uber_ps_cache;
 
   // GX Pipeline Caches - .first - pipeline, .second - pending
-  std::map<GXPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>> m_gx_pipeline_cache;
-  std::map<GXUberPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>>
+  std::unordered_map<GXPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>>
+      m_gx_pipeline_cache;
+  std::unordered_map<GXUberPipelineUid, std::pair<std::unique_ptr<AbstractPipeline>, bool>>
       m_gx_uber_pipeline_cache;
+  // Last compiled pipeline returned by GetPipelineForUid/GetPipelineForUidAsync, as the pipeline
+  // config is often flagged as changed without the UID actually being different.
+  GXPipelineUid m_last_gx_pipeline_uid;
+  const AbstractPipeline* m_last_gx_pipeline = nullptr;
   File::IOFile m_gx_pipeline_uid_cache_file;
+  // Usage of the pipelines in the UID cache, across sessions. The hit count is the number of
+  // times the pipeline was switched to.
+  struct GXPipelineUsage
+  {
+    u32 first_use_frame = std::numeric_limits<u32>::max();
+    u32 hit_count = 0;
+  };
+  std::unordered_map<GXPipelineUid, GXPipelineUsage> m_gx_pipeline_usage;
   LinearDiskCache<SerializedGXPipelineUid, u8> m_gx_pipeline_disk_cache;
   LinearDiskCache<SerializedGXUberPipelineUid, u8> m_gx_uber_pipeline_disk_cache;
 
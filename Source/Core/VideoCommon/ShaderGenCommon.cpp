@@ -10,6 +10,20 @@
 #include "VideoCommon/VideoCommon.h"
 #include "VideoCommon/VideoConfig.h"
 
+static thread_local std::string s_spare_shader_code_buffer;
+
+ShaderCode::ShaderCode() : m_buffer(std::move(s_spare_shader_code_buffer))
+{
+  m_buffer.clear();
+  m_buffer.reserve(16384);
+}
+
+ShaderCode::~ShaderCode()
+{
+  if (m_buffer.capacity() > s_spare_shader_code_buffer.capacity())
+    s_spare_shader_code_buffer = std::move(m_buffer);
+}
+
 ShaderHostConfig ShaderHostConfig::GetCurrent()
 {
   ShaderHostConfig bits = {};
@@ -15,6 +15,7 @@
 #include "Common/BitField.h"
 #include "Common/CommonTypes.h"
 #include "Common/EnumMap.h"
+#include "Common/Hash.h"
 #include "Common/StringUtil.h"
 #include "Common/TypeUtils.h"
 
@@ -103,10 +104,29 @@ private:
   uid_data data{};
 };
 
+template <class uid_data>
+struct std::hash<ShaderUid<uid_data>>
+{
+  size_t operator()(const ShaderUid<uid_data>& uid) const
+  {
+    return static_cast<size_t>(
+        Common::GetHash64(uid.GetUidDataRaw(), static_cast<u32>(uid.GetUidDataSize()), 0));
+  }
+};
+
+// The buffer is taken over from the last ShaderCode destroyed on the same thread, so generating
+// shaders on the compiler threads doesn't regrow a string from scratch for every shader.
 class ShaderCode : public ShaderGeneratorInterface
 {
 public:
-  ShaderCode() { m_buffer.reserve(16384); }
+  ShaderCode();
+  ShaderCode(const ShaderCode&) = default;
+  ShaderCode(ShaderCode&&) = default;
+  ~ShaderCode();
+
+  ShaderCode& operator=(const ShaderCode&) = default;
+  ShaderCode& operator=(ShaderCode&&) = default;
+
   const std::string& GetBuffer() const { return m_buffer; }
 
   // Writes format strings using fmtlib format strings.
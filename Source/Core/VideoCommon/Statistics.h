@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <vector>
 
 #include "VideoCommon/BPFunctions.h"
@@ -21,6 +22,11 @@ struct Statistics
 
   int num_vertex_loaders;
 
+  // Bounding box reads from the CPU thread, and how many of those were answered with deferred
+  // values instead of waiting for the GPU.
+  std::atomic<int> num_bbox_reads = 0;
+  std::atomic<int> num_bbox_reads_deferred = 0;
+
   std::array<float, 6> proj;
   std::array<float, 16> gproj;
   std::array<float, 16> g2proj;
@@ -51,12 +57,14 @@ struct Statistics
 
     int num_primitive_joins;
     int num_draw_calls;
+    int num_uber_shader_fallback_draws;
 
     int num_dlists_called;
 
     int bytes_vertex_streamed;
     int bytes_index_streamed;
     int bytes_uniform_streamed;
+    int bytes_uniform_skipped;
 
     int num_triangles_clipped;
     int num_triangles_in;
@@ -5,6 +5,7 @@
 
 #include <array>
 #include <cmath>
+#include <cstring>
 #include <memory>
 
 #include "Common/ChunkFile.h"
@@ -289,6 +290,55 @@ void VertexManagerBase::InvalidateConstants()
   VertexShaderManager::dirty = true;
   GeometryShaderManager::dirty = true;
   PixelShaderManager::dirty = true;
+  m_last_vertex_constants_valid = false;
+  m_last_geometry_constants_valid = false;
+  m_last_pixel_constants_valid = false;
+}
+
+template <typename T>
+static void SkipRedundantConstantUpload(bool* dirty, const T& constants, const T& last_constants,
+                                        bool last_constants_valid)
+{
+  if (!*dirty || !last_constants_valid ||
+      std::memcmp(&constants, &last_constants, sizeof(T)) != 0)
+  {
+    return;
+  }
+
+  *dirty = false;
+  ADDSTAT(g_stats.this_frame.bytes_uniform_skipped, sizeof(T));
+}
+
+void VertexManagerBase::SkipRedundantConstantUploads()
+{
+  SkipRedundantConstantUpload(&VertexShaderManager::dirty, VertexShaderManager::constants,
+                              m_last_vertex_constants, m_last_vertex_constants_valid);
+  SkipRedundantConstantUpload(&GeometryShaderManager::dirty, GeometryShaderManager::constants,
+                              m_last_geometry_constants, m_last_geometry_constants_valid);
+  SkipRedundantConstantUpload(&PixelShaderManager::dirty, PixelShaderManager::constants,
+                              m_last_pixel_constants, m_last_pixel_constants_valid);
+}
+
+void VertexManagerBase::RecordConstantUploads(bool vertex_dirty, bool geometry_dirty,
+                                              bool pixel_dirty)
+{
+  // A block that is still dirty after UploadUniforms() was not uploaded, e.g. because the backend
+  // had to submit its command buffer to make room.
+  if (vertex_dirty && !VertexShaderManager::dirty)
+  {
+    m_last_vertex_constants = VertexShaderManager::constants;
+    m_last_vertex_constants_valid = true;
+  }
+  if (geometry_dirty && !GeometryShaderManager::dirty)
+  {
+    m_last_geometry_constants = GeometryShaderManager::constants;
+    m_last_geometry_constants_valid = true;
+  }
+  if (pixel_dirty && !PixelShaderManager::dirty)
+  {
+    m_last_pixel_constants = PixelShaderManager::constants;
+    m_last_pixel_constants_valid = true;
+  }
 }
 
 void VertexManagerBase::UploadUtilityUniforms(const void* uniforms, u32 uniforms_size)
@@ -517,7 +567,12 @@ void VertexManagerBase::Flush()
     // Now we can upload uniforms, as nothing else will override them.
     GeometryShaderManager::SetConstants();
     PixelShaderManager::SetConstants();
+    SkipRedundantConstantUploads();
+    const bool vertex_constants_dirty = VertexShaderManager::dirty;
+    const bool geometry_constants_dirty = GeometryShaderManager::dirty;
+    const bool pixel_constants_dirty = PixelShaderManager::dirty;
     UploadUniforms();
+    RecordConstantUploads(vertex_constants_dirty, geometry_constants_dirty, pixel_constants_dirty);
 
     // Update the pipeline, or compile one if needed.
     UpdatePipelineConfig();
@@ -530,6 +585,8 @@ void VertexManagerBase::Flush()
 
       DrawCurrentBatch(base_index, num_indices, base_vertex);
       INCSTAT(g_stats.this_frame.num_draw_calls);
+      if (m_using_uber_shader_fallback)
+        INCSTAT(g_stats.this_frame.num_uber_shader_fallback_draws);
 
       if (PerfQueryBase::ShouldEmulate())
         g_perf_query->DisableQuery(bpmem.zcontrol.early_ztest ? PQG_ZCOMP_ZCOMPLOC : PQG_ZCOMP);
@@ -538,6 +595,7 @@ void VertexManagerBase::Flush()
 
       // The EFB cache is now potentially stale.
       g_framebuffer_manager->FlagPeekCacheAsOutOfDate();
+      g_framebuffer_manager->PrefetchEFBCache(m_draw_counter);
     }
   }
 
@@ -738,6 +796,7 @@ void VertexManagerBase::UpdatePipelineObject()
 
   m_current_pipeline_object = nullptr;
   m_pipeline_config_changed = false;
+  m_using_uber_shader_fallback = false;
 
   switch (g_ActiveConfig.iShaderCompilationMode)
   {
@@ -773,6 +832,7 @@ void VertexManagerBase::UpdatePipelineObject()
       // Specialized shaders not ready, use the ubershaders.
       m_current_pipeline_object =
           g_shader_cache->GetUberPipelineForUid(m_current_uber_pipeline_config);
+      m_using_uber_shader_fallback = true;
     }
     else
     {
@@ -9,6 +9,7 @@
 #include "Common/BitSet.h"
 #include "Common/CommonTypes.h"
 #include "Common/MathUtil.h"
+#include "VideoCommon/ConstantManager.h"
 #include "VideoCommon/IndexGenerator.h"
 #include "VideoCommon/RenderState.h"
 #include "VideoCommon/ShaderCache.h"
@@ -143,6 +144,9 @@ public:
   // CPU access tracking - call after a draw call is made.
   void OnDraw();
 
+  // Number of draws made so far this frame.
+  u32 GetDrawCounter() const { return m_draw_counter; }
+
   // Call after CPU access is requested.
   void OnCPUEFBAccess();
 
@@ -154,7 +158,7 @@ public:
 
 protected:
   // When utility uniforms are used, the GX uniforms need to be re-written afterwards.
-  static void InvalidateConstants();
+  void InvalidateConstants();
 
   // Prepares the buffer for the next batch of vertices.
   virtual void ResetBuffer(u32 vertex_stride);
@@ -192,6 +196,8 @@ protected:
   const AbstractPipeline* m_current_pipeline_object = nullptr;
   PrimitiveType m_current_primitive_type = PrimitiveType::Points;
   bool m_pipeline_config_changed = true;
+  // Set when the specialized pipeline is still compiling and the ubershader is used instead.
+  bool m_using_uber_shader_fallback = false;
   bool m_rasterization_state_changed = true;
   bool m_depth_state_changed = true;
   bool m_blending_state_changed = true;
@@ -206,9 +212,22 @@ private:
   void UpdatePipelineConfig();
   void UpdatePipelineObject();
 
+  // Clears the dirty flags of constant blocks whose contents match what was last uploaded.
+  void SkipRedundantConstantUploads();
+  void RecordConstantUploads(bool vertex_dirty, bool geometry_dirty, bool pixel_dirty);
+
   bool m_is_flushed = true;
   FlushStatistics m_flush_statistics = {};
 
+  // The GX constants as they were last uploaded by the backend. The managers set their dirty
+  // flag whenever one of their inputs is written, even if the resulting constants are the same.
+  VertexShaderConstants m_last_vertex_constants{};
+  GeometryShaderConstants m_last_geometry_constants{};
+  PixelShaderConstants m_last_pixel_constants{};
+  bool m_last_vertex_constants_valid = false;
+  bool m_last_geometry_constants_valid = false;
+  bool m_last_pixel_constants_valid = false;
+
   // CPU access tracking
   u32 m_draw_counter = 0;
   u32 m_last_efb_copy_draw_counter = 0;
@@ -50,6 +50,7 @@
 #include "VideoCommon/PixelEngine.h"
 #include "VideoCommon/PixelShaderManager.h"
 #include "VideoCommon/RenderBase.h"
+#include "VideoCommon/Statistics.h"
 #include "VideoCommon/TMEM.h"
 #include "VideoCommon/TextureCacheBase.h"
 #include "VideoCommon/VertexLoaderManager.h"
@@ -185,6 +186,24 @@ u16 VideoBackendBase::Video_GetBoundingBox(int index)
     warn_once = false;
   }
 
+  g_stats.num_bbox_reads.fetch_add(1, std::memory_order_relaxed);
+  if (g_ActiveConfig.bBBoxDeferReadback && g_ActiveConfig.bBBoxEnable &&
+      g_ActiveConfig.backend_info.bSupportsBBox)
+  {
+    // Don't wait for the GPU thread to catch up. Hand out the values from the last readback,
+    // which are usually the ones from the previous frame. The next one is only queued up once the
+    // game starts reading the box again, so it never sees a mix of two readbacks.
+    g_stats.num_bbox_reads_deferred.fetch_add(1, std::memory_order_relaxed);
+    if (g_renderer->BBoxBeginLatchedRead(index) && g_renderer->BBoxRequestLatch())
+    {
+      AsyncRequests::Event e;
+      e.time = 0;
+      e.type = AsyncRequests::Event::BBOX_LATCH;
+      AsyncRequests::GetInstance()->PushEvent(e, false);
+    }
+    return g_renderer->BBoxReadLatched(index);
+  }
+
   Fifo::SyncGPU(Fifo::SyncGPUReason::BBox);
 
   AsyncRequests::Event e;
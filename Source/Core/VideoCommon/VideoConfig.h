@@ -113,8 +113,13 @@ struct VideoConfig final
   // Hacks
   bool bEFBAccessEnable = false;
   bool bEFBAccessDeferInvalidation = false;
+  // Read back the EFB tiles accessed last frame ahead of time, at the draw they were read after.
+  bool bEFBAccessPrefetch = false;
   bool bPerfQueriesEnable = false;
   bool bBBoxEnable = false;
+  // Return the last bounding box values read back instead of waiting for the GPU. Games that only
+  // use them a frame late can opt into this from their game INI.
+  bool bBBoxDeferReadback = false;
   bool bForceProgressive = false;
 
   bool bEFBEmulateFormatChanges = false;
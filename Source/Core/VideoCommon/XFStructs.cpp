@@ -113,10 +113,13 @@ static void XFRegWritten(u32 address, u32 value)
     case XFMEM_SETVIEWPORT + 3:
     case XFMEM_SETVIEWPORT + 4:
     case XFMEM_SETVIEWPORT + 5:
-      g_vertex_manager->Flush();
-      VertexShaderManager::SetViewportChanged();
-      PixelShaderManager::SetViewportChanged();
-      GeometryShaderManager::SetViewportChanged();
+      if (((u32*)&xfmem)[address] != value)
+      {
+        g_vertex_manager->Flush();
+        VertexShaderManager::SetViewportChanged();
+        PixelShaderManager::SetViewportChanged();
+        GeometryShaderManager::SetViewportChanged();
+      }
       break;
 
     case XFMEM_SETPROJECTION:
@@ -126,9 +129,12 @@ static void XFRegWritten(u32 address, u32 value)
     case XFMEM_SETPROJECTION + 4:
     case XFMEM_SETPROJECTION + 5:
     case XFMEM_SETPROJECTION + 6:
-      g_vertex_manager->Flush();
-      VertexShaderManager::SetProjectionChanged();
-      GeometryShaderManager::SetProjectionChanged();
+      if (((u32*)&xfmem)[address] != value)
+      {
+        g_vertex_manager->Flush();
+        VertexShaderManager::SetProjectionChanged();
+        GeometryShaderManager::SetProjectionChanged();
+      }
       break;
 
     case XFMEM_SETNUMTEXGENS:  // GXSetNumTexGens
@@ -144,8 +150,11 @@ static void XFRegWritten(u32 address, u32 value)
     case XFMEM_SETTEXMTXINFO + 5:
     case XFMEM_SETTEXMTXINFO + 6:
     case XFMEM_SETTEXMTXINFO + 7:
-      g_vertex_manager->Flush();
-      VertexShaderManager::SetTexMatrixInfoChanged(address - XFMEM_SETTEXMTXINFO);
+      if (((u32*)&xfmem)[address] != value)
+      {
+        g_vertex_manager->Flush();
+        VertexShaderManager::SetTexMatrixInfoChanged(address - XFMEM_SETTEXMTXINFO);
+      }
       break;
 
     case XFMEM_SETPOSTMTXINFO:
@@ -156,8 +165,11 @@ static void XFRegWritten(u32 address, u32 value)
     case XFMEM_SETPOSTMTXINFO + 5:
     case XFMEM_SETPOSTMTXINFO + 6:
     case XFMEM_SETPOSTMTXINFO + 7:
-      g_vertex_manager->Flush();
-      VertexShaderManager::SetTexMatrixInfoChanged(address - XFMEM_SETPOSTMTXINFO);
+      if (((u32*)&xfmem)[address] != value)
+      {
+        g_vertex_manager->Flush();
+        VertexShaderManager::SetTexMatrixInfoChanged(address - XFMEM_SETPOSTMTXINFO);
+      }
       break;
 
     // --------------
@@ -222,12 +234,20 @@ void LoadXFReg(u16 base_address, u8 transfer_size, const u8* data)
       base_address = XFMEM_REGISTERS_START;
     }
 
-    XFMemWritten(xf_mem_transfer_size, xf_mem_base);
+    // Games commonly reload matrices and lights that haven't changed between draws. Since those
+    // writes can't affect rendering, skip them instead of splitting the current batch.
+    u32* const xf_mem = (u32*)&xfmem + xf_mem_base;
     for (u32 i = 0; i < xf_mem_transfer_size; i++)
     {
-      ((u32*)&xfmem)[xf_mem_base + i] = Common::swap32(data);
-      data += 4;
+      if (xf_mem[i] != Common::swap32(data + i * 4))
+      {
+        XFMemWritten(xf_mem_transfer_size - i, xf_mem_base + i);
+        for (; i < xf_mem_transfer_size; i++)
+          xf_mem[i] = Common::swap32(data + i * 4);
+        break;
+      }
     }
+    data += xf_mem_transfer_size * 4;
   }
 
   // write to XF regs
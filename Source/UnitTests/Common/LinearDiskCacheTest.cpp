@@ -0,0 +1,130 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/FileUtil.h"
+#include "Common/LinearDiskCache.h"
+
+namespace
+{
+class CollectingReader : public LinearDiskCacheReader<u32, u8>
+{
+public:
+  void Read(const u32& key, const u8* value, u32 value_size) override
+  {
+    entries.emplace_back(key, std::vector<u8>(value, value + value_size));
+  }
+
+  std::vector<std::pair<u32, std::vector<u8>>> entries;
+};
+
+void Append(LinearDiskCache<u32, u8>& cache, u32 key, std::vector<u8> value)
+{
+  cache.Append(key, value.data(), static_cast<u32>(value.size()));
+}
+}  // namespace
+
+class LinearDiskCacheTest : public testing::Test
+{
+protected:
+  LinearDiskCacheTest()
+      : m_directory(File::CreateTempDir()), m_filename(m_directory + "/cache.bin")
+  {
+  }
+
+  ~LinearDiskCacheTest() override
+  {
+    if (!m_directory.empty())
+      File::DeleteDirRecursively(m_directory);
+  }
+
+  void SetUp() override
+  {
+    if (m_directory.empty())
+      FAIL();
+  }
+
+  const std::string m_directory;
+  const std::string m_filename;
+};
+
+TEST_F(LinearDiskCacheTest, ReadsAppendedEntries)
+{
+  {
+    LinearDiskCache<u32, u8> cache;
+    CollectingReader reader;
+    EXPECT_EQ(cache.OpenAndRead(m_filename, reader), 0u);
+    Append(cache, 1, {1, 2, 3});
+    Append(cache, 2, {});
+    Append(cache, 3, {4});
+  }
+
+  LinearDiskCache<u32, u8> cache;
+  CollectingReader reader;
+  EXPECT_EQ(cache.OpenAndRead(m_filename, reader), 3u);
+  const std::vector<std::pair<u32, std::vector<u8>>> expected = {
+      {1, {1, 2, 3}}, {2, {}}, {3, {4}}};
+  EXPECT_EQ(reader.entries, expected);
+}
+
+TEST_F(LinearDiskCacheTest, DuplicateKeysAreCompacted)
+{
+  {
+    LinearDiskCache<u32, u8> cache;
+    CollectingReader reader;
+    cache.OpenAndRead(m_filename, reader);
+    Append(cache, 1, {1, 1, 1, 1});
+    Append(cache, 2, {2});
+    Append(cache, 1, {3});
+    Append(cache, 2, {4, 4});
+    Append(cache, 5, {5});
+  }
+  const u64 original_size = File::GetSize(m_filename);
+
+  const std::vector<std::pair<u32, std::vector<u8>>> expected = {{1, {3}}, {2, {4, 4}}, {5, {5}}};
+  {
+    LinearDiskCache<u32, u8> cache;
+    CollectingReader reader;
+    EXPECT_EQ(cache.OpenAndRead(m_filename, reader), 3u);
+    EXPECT_EQ(reader.entries, expected);
+
+    // Appending to a compacted file must keep it valid.
+    Append(cache, 6, {6});
+  }
+  EXPECT_LT(File::GetSize(m_filename), original_size);
+  EXPECT_FALSE(File::Exists(m_filename + ".compact"));
+
+  LinearDiskCache<u32, u8> cache;
+  CollectingReader reader;
+  EXPECT_EQ(cache.OpenAndRead(m_filename, reader), 4u);
+  auto expected_after_append = expected;
+  expected_after_append.emplace_back(6, std::vector<u8>{6});
+  EXPECT_EQ(reader.entries, expected_after_append);
+}
+
+TEST_F(LinearDiskCacheTest, TruncatedEntryIsDropped)
+{
+  {
+    LinearDiskCache<u32, u8> cache;
+    CollectingReader reader;
+    cache.OpenAndRead(m_filename, reader);
+    Append(cache, 1, {1});
+    Append(cache, 2, {2, 2, 2, 2, 2, 2, 2, 2});
+  }
+  {
+    File::IOFile file(m_filename, "r+b");
+    ASSERT_TRUE(file.Resize(file.GetSize() - 6));
+  }
+
+  LinearDiskCache<u32, u8> cache;
+  CollectingReader reader;
+  EXPECT_EQ(cache.OpenAndRead(m_filename, reader), 1u);
+  const std::vector<std::pair<u32, std::vector<u8>>> expected = {{1, {1}}};
+  EXPECT_EQ(reader.entries, expected);
+}
@@ -0,0 +1,292 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/MathUtil.h"
+#include "Core/HW/DSPHLE/UCodes/AXMixing.h"
+#include "Core/HW/DSPHLE/UCodes/AXStructs.h"
+
+using namespace DSP::HLE;
+
+namespace
+{
+// Reference implementations, matching the original per-sample code in AXVoice.h.
+void ReferenceVolumeRamp(s16* samples, u32 count, u16& volume, u16 volume_delta)
+{
+  for (u32 i = 0; i < count; ++i)
+  {
+    const s32 sample = ((s32)samples[i] * volume) >> 15;
+    samples[i] = std::clamp(sample, -32767, 32767);
+    volume += volume_delta;
+  }
+}
+
+void ReferenceMixAdd(int* out, const s16* input, u32 count, u16& volume, u16 volume_delta,
+                     s16* dpop)
+{
+  for (u32 i = 0; i < count; ++i)
+  {
+    s64 sample = input[i];
+    sample *= volume;
+    sample >>= 15;
+    sample = std::clamp((s32)sample, -32767, 32767);
+
+    out[i] += (s16)sample;
+    volume += volume_delta;
+
+    *dpop = (s16)sample;
+  }
+}
+
+u32 ReferenceResample(const std::vector<s16>& input, s16* output, u32 count, s16* last_samples,
+                      u32 curr_pos, u32 ratio, bool polyphase, const s16* coeffs)
+{
+  u32 read_samples_count = 0;
+  s16 temp[4];
+  u32 idx = 0;
+
+  temp[idx++ & 3] = last_samples[0];
+  temp[idx++ & 3] = last_samples[1];
+  temp[idx++ & 3] = last_samples[2];
+  temp[idx++ & 3] = last_samples[3];
+
+  for (u32 i = 0; i < count; ++i)
+  {
+    curr_pos += ratio;
+    while (curr_pos >= 0x10000)
+    {
+      temp[idx++ & 3] = input[read_samples_count++];
+      curr_pos -= 0x10000;
+    }
+
+    if (polyphase)
+    {
+      const s16* c = &coeffs[((curr_pos & 0xFFFF) >> 9) << 2];
+      s64 t0 = temp[idx++ & 3];
+      s64 t1 = temp[idx++ & 3];
+      s64 t2 = temp[idx++ & 3];
+      s64 t3 = temp[idx++ & 3];
+      output[i] = MathUtil::SaturatingCast<s16>((t0 * c[0] + t1 * c[1] + t2 * c[2] + t3 * c[3]) >>
+                                                15);
+      continue;
+    }
+
+    u16 curr_frac = curr_pos & 0xFFFF;
+    u16 inv_curr_frac = -curr_frac;
+    if (curr_frac)
+    {
+      s32 s0 = temp[idx++ & 3];
+      s32 s1 = temp[idx++ & 3];
+      output[i] = ((s0 * inv_curr_frac) + (s1 * curr_frac)) >> 16;
+      idx += 2;
+    }
+    else
+    {
+      output[i] = temp[idx++ & 3];
+      idx += 3;
+    }
+  }
+
+  last_samples[3] = temp[--idx & 3];
+  last_samples[2] = temp[--idx & 3];
+  last_samples[1] = temp[--idx & 3];
+  last_samples[0] = temp[--idx & 3];
+
+  return curr_pos;
+}
+
+template <typename T>
+std::vector<T> RandomVector(std::mt19937& rng, size_t size)
+{
+  std::uniform_int_distribution<int> dist(std::numeric_limits<T>::min(),
+                                          std::numeric_limits<T>::max());
+  std::vector<T> result(size);
+  std::generate(result.begin(), result.end(), [&] { return static_cast<T>(dist(rng)); });
+  return result;
+}
+
+void CheckResample(std::mt19937& rng, const std::vector<s16>& coeffs, int srctype, u32 count,
+                   u32 curr_pos, u32 ratio)
+{
+  const std::vector<s16> input =
+      RandomVector<s16>(rng, ((curr_pos + u64(count) * ratio) >> 16) + 2);
+  const std::vector<s16> history = RandomVector<s16>(rng, 4);
+
+  std::vector<s16> expected(count);
+  std::array<s16, 4> expected_history;
+  std::copy_n(history.begin(), 4, expected_history.begin());
+  const u32 expected_pos =
+      ReferenceResample(input, expected.data(), count, expected_history.data(), curr_pos, ratio,
+                        srctype == SRCTYPE_POLYPHASE, coeffs.data());
+
+  std::vector<s16> actual(count);
+  std::array<s16, 4> actual_history;
+  std::copy_n(history.begin(), 4, actual_history.begin());
+  u32 reads = 0;
+  const u32 actual_pos = ResampleAudio(
+      [&](u32 i) {
+        EXPECT_EQ(i, reads++);
+        return input[i];
+      },
+      actual.data(), count, actual_history.data(), curr_pos, ratio, srctype, coeffs.data());
+
+  EXPECT_EQ(expected, actual);
+  EXPECT_EQ(expected_history, actual_history);
+  EXPECT_EQ(expected_pos, actual_pos);
+  EXPECT_EQ(reads, (curr_pos + u64(count) * ratio) >> 16);
+}
+
+// Extreme values that exercise the saturation and sign handling of the kernels.
+constexpr std::array<s16, 6> EDGE_SAMPLES = {-32768, -32767, -1, 0, 1, 32767};
+constexpr std::array<u16, 6> EDGE_VOLUMES = {0x0000, 0x7FFF, 0x8000, 0x8001, 0xFFFE, 0xFFFF};
+}  // namespace
+
+TEST(AXMixing, VolumeRampMatchesReference)
+{
+  std::mt19937 rng(0x4158);
+  std::uniform_int_distribution<u32> u16_dist(0, 0xFFFF);
+
+  for (u32 count : {0u, 1u, 5u, 8u, 13u, 32u, 96u})
+  {
+    for (int iteration = 0; iteration < 200; ++iteration)
+    {
+      const std::vector<s16> input = RandomVector<s16>(rng, count);
+      const u16 start_volume = u16_dist(rng);
+      const u16 delta = u16_dist(rng);
+
+      std::vector<s16> expected = input;
+      u16 expected_volume = start_volume;
+      ReferenceVolumeRamp(expected.data(), count, expected_volume, delta);
+
+      std::vector<s16> actual = input;
+      u16 actual_volume = start_volume;
+      ApplyVolumeRamp(actual.data(), count, actual_volume, delta);
+
+      EXPECT_EQ(expected, actual);
+      EXPECT_EQ(expected_volume, actual_volume);
+    }
+  }
+}
+
+TEST(AXMixing, MixAddMatchesReference)
+{
+  std::mt19937 rng(0x4D49);
+  std::uniform_int_distribution<u32> u16_dist(0, 0xFFFF);
+
+  for (u32 count : {1u, 6u, 8u, 18u, 32u, 96u})
+  {
+    for (int iteration = 0; iteration < 200; ++iteration)
+    {
+      const std::vector<s16> input = RandomVector<s16>(rng, count);
+      const std::vector<s16> base = RandomVector<s16>(rng, count);
+      const u16 start_volume = u16_dist(rng);
+      const u16 delta = iteration % 2 ? u16_dist(rng) : 0;
+
+      std::vector<int> expected(base.begin(), base.end());
+      u16 expected_volume = start_volume;
+      s16 expected_dpop = 0;
+      ReferenceMixAdd(expected.data(), input.data(), count, expected_volume, delta,
+                      &expected_dpop);
+
+      std::vector<int> actual(base.begin(), base.end());
+      u16 actual_volume = start_volume;
+      s16 actual_dpop = 0;
+      MixAddRamped(actual.data(), input.data(), count, actual_volume, delta, &actual_dpop);
+
+      EXPECT_EQ(expected, actual);
+      EXPECT_EQ(expected_volume, actual_volume);
+      EXPECT_EQ(expected_dpop, actual_dpop);
+    }
+  }
+}
+
+TEST(AXMixing, EdgeValues)
+{
+  std::vector<s16> input;
+  for (s16 sample : EDGE_SAMPLES)
+    input.insert(input.end(), EDGE_VOLUMES.size(), sample);
+
+  for (u16 volume : EDGE_VOLUMES)
+  {
+    for (u16 delta : EDGE_VOLUMES)
+    {
+      const u32 count = static_cast<u32>(input.size());
+
+      std::vector<int> expected(count, 0);
+      u16 expected_volume = volume;
+      s16 expected_dpop = 0;
+      ReferenceMixAdd(expected.data(), input.data(), count, expected_volume, delta,
+                      &expected_dpop);
+
+      std::vector<int> actual(count, 0);
+      u16 actual_volume = volume;
+      s16 actual_dpop = 0;
+      MixAddRamped(actual.data(), input.data(), count, actual_volume, delta, &actual_dpop);
+
+      EXPECT_EQ(expected, actual);
+      EXPECT_EQ(expected_dpop, actual_dpop);
+    }
+  }
+}
+
+TEST(AXMixing, ResampleMatchesReference)
+{
+  std::mt19937 rng(0x5352);
+  const std::vector<s16> coeffs = RandomVector<s16>(rng, 0x200);
+
+  std::uniform_int_distribution<u32> frac_dist(0, 0xFFFF);
+  std::uniform_int_distribution<u32> ratio_dist(0x100, 0x80000);
+
+  for (int srctype : {SRCTYPE_POLYPHASE, SRCTYPE_LINEAR})
+  {
+    for (u32 count : {18u, 32u, 96u})
+    {
+      for (int iteration = 0; iteration < 200; ++iteration)
+      {
+        // Include exact integer positions, which take the no-interpolation path.
+        const bool integer_steps = iteration % 8 == 0;
+        const u32 ratio = integer_steps ? 0x10000 * (1 + iteration % 3) : ratio_dist(rng);
+        const u32 curr_pos = integer_steps ? 0 : frac_dist(rng);
+        CheckResample(rng, coeffs, srctype, count, curr_pos, ratio);
+      }
+    }
+  }
+}
+
+// Positions with an integer part and reads of more than 2048 input samples aren't batched, and
+// go through the per-sample fallback instead.
+TEST(AXMixing, ResampleFallbackMatchesReference)
+{
+  std::mt19937 rng(0x5046);
+  const std::vector<s16> coeffs = RandomVector<s16>(rng, 0x200);
+
+  std::uniform_int_distribution<u32> pos_dist(0x10000, 0x3FFFF);
+  std::uniform_int_distribution<u32> frac_dist(0, 0xFFFF);
+  std::uniform_int_distribution<u32> ratio_dist(0x100, 0x80000);
+  std::uniform_int_distribution<u32> large_ratio_dist(0x160000, 0x200000);
+
+  for (int srctype : {SRCTYPE_POLYPHASE, SRCTYPE_LINEAR})
+  {
+    for (u32 count : {18u, 32u, 96u})
+    {
+      for (int iteration = 0; iteration < 200; ++iteration)
+      {
+        const bool integer_position = iteration % 2;
+        const u32 curr_pos = integer_position ? pos_dist(rng) : frac_dist(rng);
+        const u32 ratio = integer_position ?
+                              ratio_dist(rng) :
+                              static_cast<u32>(u64(large_ratio_dist(rng)) * 96 / count);
+        ASSERT_TRUE(curr_pos >= 0x10000 || ((curr_pos + u64(count) * ratio) >> 16) > 2048);
+        CheckResample(rng, coeffs, srctype, count, curr_pos, ratio);
+      }
+    }
+  }
+}
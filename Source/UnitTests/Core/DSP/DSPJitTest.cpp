@@ -0,0 +1,111 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/ChunkFile.h"
+#include "Common/CommonTypes.h"
+#include "Common/MemoryUtil.h"
+#include "Common/MsgHandler.h"
+#include "Core/DSP/DSPCore.h"
+#include "Core/DSP/DSPHost.h"
+#include "Core/DSP/DSPTables.h"
+
+namespace
+{
+constexpr u16 OPCODE_LRI_AXH0 = 0x009a;
+constexpr u16 OPCODE_HALT = 0x0021;
+
+class DSPJitTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    // There are no DSP ROMs here, and the uCodes below don't need them.
+    Common::RegisterMsgAlertHandler([](const char*, const char*, bool, Common::MsgType) {
+      return false;
+    });
+
+    DSP::InitInstructionTable();
+
+    DSP::DSPInitOptions opts;
+    opts.core_type = DSP::DSPInitOptions::CoreType::JIT64;
+    ASSERT_TRUE(m_core.Initialize(opts));
+    ASSERT_TRUE(m_core.IsJITCreated());
+  }
+
+  void TearDown() override { m_core.Shutdown(); }
+
+  // Uploads a uCode that sets $AX0.H to value and halts.
+  void LoadUCode(u16 value)
+  {
+    DSP::SDSP& state = m_core.DSPState();
+    Common::UnWriteProtectMemory(state.iram, DSP::DSP_IRAM_BYTE_SIZE, false);
+    std::fill_n(state.iram, DSP::DSP_IRAM_SIZE, OPCODE_HALT);
+    state.iram[0] = OPCODE_LRI_AXH0;
+    state.iram[1] = value;
+    Common::WriteProtectMemory(state.iram, DSP::DSP_IRAM_BYTE_SIZE, false);
+    DSP::Host::CodeLoaded(m_core, reinterpret_cast<const u8*>(state.iram),
+                          DSP::DSP_IRAM_BYTE_SIZE);
+  }
+
+  u16 Run()
+  {
+    DSP::SDSP& state = m_core.DSPState();
+    state.pc = 0;
+    state.control_reg &= ~DSP::CR_HALT;
+    state.r.ax[0].h = 0;
+    m_core.RunCycles(100);
+    return state.r.ax[0].h;
+  }
+
+  std::vector<u8> SaveState()
+  {
+    u8* ptr = nullptr;
+    PointerWrap p_measure(&ptr, 0, PointerWrap::Mode::Measure);
+    m_core.DoState(p_measure);
+    const size_t buffer_size = reinterpret_cast<size_t>(ptr);
+
+    std::vector<u8> buffer(buffer_size);
+    ptr = buffer.data();
+    PointerWrap p(&ptr, buffer_size, PointerWrap::Mode::Write);
+    m_core.DoState(p);
+    return buffer;
+  }
+
+  void LoadState(std::vector<u8> buffer)
+  {
+    u8* ptr = buffer.data();
+    PointerWrap p(&ptr, buffer.size(), PointerWrap::Mode::Read);
+    m_core.DoState(p);
+    ASSERT_TRUE(p.IsReadMode());
+  }
+
+  DSP::DSPCore m_core;
+};
+}  // namespace
+
+TEST_F(DSPJitTest, LoadStateWithDifferentIRAM)
+{
+  LoadUCode(0x1111);
+  EXPECT_EQ(0x1111, Run());
+  const std::vector<u8> state = SaveState();
+
+  LoadUCode(0x2222);
+  EXPECT_EQ(0x2222, Run());
+
+  // The loaded state's uCode must run, not the blocks compiled for the current one.
+  LoadState(state);
+  EXPECT_EQ(0x1111, Run());
+
+  // Blocks compiled after loading must not have been cached as the other uCode's.
+  LoadUCode(0x2222);
+  EXPECT_EQ(0x2222, Run());
+  LoadState(state);
+  EXPECT_EQ(0x1111, Run());
+  LoadUCode(0x1111);
+  EXPECT_EQ(0x1111, Run());
+}
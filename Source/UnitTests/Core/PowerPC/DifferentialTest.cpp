@@ -0,0 +1,641 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "Common/Config/Config.h"
+#include "Common/FileUtil.h"
+#include "Common/GekkoDisassembler.h"
+#include "Core/Config/MainSettings.h"
+#include "Core/ConfigManager.h"
+#include "Core/Core.h"
+#include "Core/CoreTiming.h"
+#include "Core/HW/Memmap.h"
+#include "Core/PowerPC/CPUCoreBase.h"
+#include "Core/PowerPC/Gekko.h"
+#include "Core/PowerPC/Interpreter/Interpreter.h"
+#include "Core/PowerPC/JitInterface.h"
+#include "Core/PowerPC/PowerPC.h"
+#include "UICommon/UICommon.h"
+
+// Runs randomly generated straight-line blocks through the interpreter and every other CPU core
+// available on the host, and checks that they all leave the registers and memory in the same state.
+//
+// The blocks run in real mode with the FPU enabled. Every block ends with a blr to RETURN_ADDRESS,
+// which is never executed. Loads and stores only use r1 as their base register, which always
+// points at a scratch area and is never written, so memory accesses cannot hit the code or MMIO.
+//
+// FPSCR isn't compared, since the JITs deliberately don't track its exception and FPRF bits. For
+// the same reason floating point instructions never set Rc, and floating point registers start
+// out as ordinary single precision values. Accurate NaNs are enabled, so floating point registers
+// are compared bit for bit, including the sign and payload of NaNs.
+
+namespace
+{
+constexpr u32 CODE_ADDRESS = 0x00004000;
+constexpr u32 RETURN_ADDRESS = 0x00003000;
+constexpr u32 SCRATCH_ADDRESS = 0x00010000;
+constexpr u32 SCRATCH_SIZE = 0x800;
+constexpr u32 SCRATCH_BASE_GPR = 1;
+
+constexpr u32 SEED = 0x0D1FF;
+constexpr int BLOCK_COUNT = 300;
+constexpr int INSTRUCTIONS_PER_BLOCK = 32;
+
+class ScopeInit final
+{
+public:
+  ScopeInit() : m_profile_path(File::CreateTempDir())
+  {
+    if (!UserDirectoryExists())
+      return;
+
+    Core::DeclareAsCPUThread();
+    UICommon::SetUserDirectory(m_profile_path);
+    Config::Init();
+    SConfig::Init();
+    // Keep every core on the slow memory path, so no fault handler is needed.
+    Config::SetCurrent(Config::MAIN_FASTMEM, false);
+    // Chains of random floating point instructions can create new NaNs (0/0, inf-inf). Without
+    // this, Jit64 leaves the host's default NaN, whose sign differs from the PowerPC one.
+    Config::SetCurrent(Config::MAIN_ACCURATE_NANS, true);
+    Memory::Init();
+    PowerPC::Init(PowerPC::CPUCore::Interpreter);
+    CoreTiming::Init();
+  }
+  ~ScopeInit()
+  {
+    if (!UserDirectoryExists())
+      return;
+
+    CoreTiming::Shutdown();
+    PowerPC::Shutdown();
+    Memory::Shutdown();
+    SConfig::Shutdown();
+    Config::Shutdown();
+    Core::UndeclareAsCPUThread();
+    File::DeleteDirRecursively(m_profile_path);
+  }
+  bool UserDirectoryExists() const { return !m_profile_path.empty(); }
+
+private:
+  std::string m_profile_path;
+};
+
+struct CPUStateSnapshot
+{
+  std::array<u32, 32> gpr{};
+  std::array<u64, 32> ps0{};
+  std::array<u64, 32> ps1{};
+  u32 cr = 0;
+  u32 xer = 0;
+  u32 lr = 0;
+  u32 ctr = 0;
+  u32 pc = 0;
+  u32 msr = 0;
+  std::array<u8, SCRATCH_SIZE> scratch{};
+
+  bool operator==(const CPUStateSnapshot&) const = default;
+};
+
+void LoadSnapshot(const CPUStateSnapshot& state)
+{
+  auto& ppc_state = PowerPC::ppcState;
+
+  for (size_t i = 0; i < state.gpr.size(); ++i)
+    ppc_state.gpr[i] = state.gpr[i];
+  for (size_t i = 0; i < state.ps0.size(); ++i)
+    ppc_state.ps[i].SetBoth(state.ps0[i], state.ps1[i]);
+  ppc_state.cr.Set(state.cr);
+  PowerPC::SetXER(UReg_XER(state.xer));
+  ppc_state.spr[SPR_LR] = state.lr;
+  ppc_state.spr[SPR_CTR] = state.ctr;
+  ppc_state.pc = state.pc;
+  ppc_state.npc = state.pc;
+  ppc_state.msr.Hex = state.msr;
+
+  ppc_state.fpscr.Hex = 0;
+  ppc_state.Exceptions = 0;
+  ppc_state.spr[SPR_GQR0] = 0;
+  ppc_state.spr[SPR_HID2] = 0;
+  HID2.PSE = 1;
+  HID2.LSQE = 1;
+
+  Memory::CopyToEmu(SCRATCH_ADDRESS, state.scratch.data(), state.scratch.size());
+}
+
+CPUStateSnapshot SaveSnapshot()
+{
+  const auto& ppc_state = PowerPC::ppcState;
+  CPUStateSnapshot state;
+
+  for (size_t i = 0; i < state.gpr.size(); ++i)
+    state.gpr[i] = ppc_state.gpr[i];
+  for (size_t i = 0; i < state.ps0.size(); ++i)
+  {
+    state.ps0[i] = ppc_state.ps[i].PS0AsU64();
+    state.ps1[i] = ppc_state.ps[i].PS1AsU64();
+  }
+  state.cr = ppc_state.cr.Get();
+  state.xer = PowerPC::GetXER().Hex;
+  state.lr = ppc_state.spr[SPR_LR];
+  state.ctr = ppc_state.spr[SPR_CTR];
+  state.pc = ppc_state.pc;
+  state.msr = ppc_state.msr.Hex;
+
+  Memory::CopyFromEmu(state.scratch.data(), SCRATCH_ADDRESS, state.scratch.size());
+  return state;
+}
+
+class InstructionGenerator
+{
+public:
+  explicit InstructionGenerator(u32 seed) : m_rng(seed) {}
+
+  std::vector<u32> GenerateBlock()
+  {
+    std::vector<u32> code;
+    for (int i = 0; i < INSTRUCTIONS_PER_BLOCK; ++i)
+      code.push_back(GenerateInstruction().hex);
+
+    // blr
+    code.push_back(0x4E800020);
+    return code;
+  }
+
+  CPUStateSnapshot GenerateState()
+  {
+    CPUStateSnapshot state;
+
+    for (u32& gpr : state.gpr)
+    {
+      // Small values make shifts, rotates and divisions more interesting than full-range ones.
+      gpr = Random(4) == 0 ? Random(64) : static_cast<u32>(m_rng());
+    }
+    state.gpr[SCRATCH_BASE_GPR] = SCRATCH_ADDRESS;
+
+    for (size_t i = 0; i < state.ps0.size(); ++i)
+    {
+      state.ps0[i] = Common::BitCast<u64>(RandomFloat());
+      state.ps1[i] = Common::BitCast<u64>(RandomFloat());
+    }
+
+    state.cr = static_cast<u32>(m_rng());
+    // SO, OV and CA
+    state.xer = static_cast<u32>(m_rng()) & 0xE0000000;
+    state.lr = RETURN_ADDRESS;
+    state.ctr = static_cast<u32>(m_rng());
+    state.pc = CODE_ADDRESS;
+    UReg_MSR msr;
+    msr.FP = 1;
+    state.msr = msr.Hex;
+
+    // Ordinary single precision values, so that FP loads and stores see sensible data too.
+    for (size_t i = 0; i < state.scratch.size(); i += sizeof(u32))
+    {
+      const u32 value = Common::BitCast<u32>(static_cast<float>(RandomFloat()));
+      state.scratch[i] = static_cast<u8>(value >> 24);
+      state.scratch[i + 1] = static_cast<u8>(value >> 16);
+      state.scratch[i + 2] = static_cast<u8>(value >> 8);
+      state.scratch[i + 3] = static_cast<u8>(value);
+    }
+
+    return state;
+  }
+
+private:
+  u32 Random(u32 range) { return static_cast<u32>(m_rng() % range); }
+  bool RandomBool() { return (m_rng() & 1) != 0; }
+
+  double RandomFloat()
+  {
+    const float mantissa = std::uniform_real_distribution<float>(1.0f, 2.0f)(m_rng);
+    const float value = std::ldexp(mantissa, static_cast<int>(Random(17)) - 8);
+    return RandomBool() ? -value : value;
+  }
+
+  u32 SourceGPR() { return Random(32); }
+  u32 DestGPR()
+  {
+    u32 reg;
+    do
+    {
+      reg = Random(32);
+    } while (reg == SCRATCH_BASE_GPR);
+    return reg;
+  }
+  u32 FPR() { return Random(32); }
+  s32 Displacement(u32 alignment)
+  {
+    return static_cast<s32>(Random(SCRATCH_SIZE / 2) & ~(alignment - 1));
+  }
+
+  UGeckoInstruction GenerateInstruction()
+  {
+    switch (Random(6))
+    {
+    case 0:
+      return IntegerArithmetic();
+    case 1:
+      return IntegerLogical();
+    case 2:
+      return ConditionRegister();
+    case 3:
+      return LoadStore();
+    case 4:
+      return FloatingPoint();
+    default:
+      return PairedSingle();
+    }
+  }
+
+  UGeckoInstruction IntegerArithmetic()
+  {
+    // XO-form: add, addc, adde, addze, addme, subf, subfc, subfe, subfze, subfme, neg, mullw,
+    // mulhw, mulhwu, divw, divwu
+    static constexpr std::array<u32, 16> xo = {266, 10, 138, 202, 234, 40, 8,   136,
+                                               200, 232, 104, 235, 75,  11, 491, 459};
+    // D-form: mulli, subfic, addic, addic., addi, addis
+    static constexpr std::array<u32, 6> d = {7, 8, 12, 13, 14, 15};
+
+    UGeckoInstruction inst{};
+    if (RandomBool())
+    {
+      const u32 subop = xo[Random(xo.size())];
+      const bool has_oe = subop != 75 && subop != 11;
+      const bool has_rb = subop != 202 && subop != 234 && subop != 200 && subop != 232 &&
+                          subop != 104;
+      inst.OPCD = 31;
+      inst.RD = DestGPR();
+      inst.RA = SourceGPR();
+      inst.RB = has_rb ? SourceGPR() : 0;
+      inst.SUBOP10 = subop | (has_oe && RandomBool() ? 0x200 : 0);
+      inst.Rc = RandomBool();
+    }
+    else
+    {
+      inst.OPCD = d[Random(d.size())];
+      inst.RD = DestGPR();
+      inst.RA = SourceGPR();
+      inst.SIMM_16 = static_cast<s16>(m_rng());
+    }
+    return inst;
+  }
+
+  UGeckoInstruction IntegerLogical()
+  {
+    // X-form: and, or, xor, nand, nor, eqv, andc, orc, slw, srw, sraw, srawi, cntlzw, extsb, extsh
+    static constexpr std::array<u32, 15> x = {28,  444, 316, 476, 124, 284, 60, 412,
+                                              24,  536, 792, 824, 26,  954, 922};
+    // D-form: ori, oris, xori, xoris, andi., andis.
+    static constexpr std::array<u32, 6> d = {24, 25, 26, 27, 28, 29};
+    // M-form: rlwimi, rlwinm, rlwnm
+    static constexpr std::array<u32, 3> m = {20, 21, 23};
+
+    UGeckoInstruction inst{};
+    switch (Random(3))
+    {
+    case 0:
+    {
+      const u32 subop = x[Random(x.size())];
+      const bool has_rb = subop != 26 && subop != 954 && subop != 922;
+      inst.OPCD = 31;
+      inst.RS = SourceGPR();
+      inst.RA = DestGPR();
+      inst.RB = has_rb ? SourceGPR() : 0;
+      inst.SUBOP10 = subop;
+      inst.Rc = RandomBool();
+      break;
+    }
+    case 1:
+      inst.OPCD = d[Random(d.size())];
+      inst.RS = SourceGPR();
+      inst.RA = DestGPR();
+      inst.UIMM = static_cast<u16>(m_rng());
+      break;
+    default:
+      inst.OPCD = m[Random(m.size())];
+      inst.RS = SourceGPR();
+      inst.RA = DestGPR();
+      inst.SH = Random(32);
+      inst.MB = Random(32);
+      inst.ME = Random(32);
+      inst.Rc = RandomBool();
+      break;
+    }
+    return inst;
+  }
+
+  UGeckoInstruction ConditionRegister()
+  {
+    // crand, cror, crxor, crnand, crnor, creqv, crandc, crorc
+    static constexpr std::array<u32, 8> cr_logical = {257, 449, 193, 225, 33, 289, 129, 417};
+
+    UGeckoInstruction inst{};
+    switch (Random(6))
+    {
+    case 0:
+      // cmp, cmpl
+      inst.OPCD = 31;
+      inst.CRFD = Random(8);
+      inst.RA = SourceGPR();
+      inst.RB = SourceGPR();
+      inst.SUBOP10 = RandomBool() ? 0 : 32;
+      break;
+    case 1:
+      // cmpli, cmpi
+      inst.OPCD = 10 + Random(2);
+      inst.CRFD = Random(8);
+      inst.RA = SourceGPR();
+      inst.UIMM = static_cast<u16>(m_rng());
+      break;
+    case 2:
+      inst.OPCD = 19;
+      inst.CRBD = Random(32);
+      inst.CRBA = Random(32);
+      inst.CRBB = Random(32);
+      inst.SUBOP10 = cr_logical[Random(cr_logical.size())];
+      break;
+    case 3:
+      // mcrf
+      inst.OPCD = 19;
+      inst.CRFD = Random(8);
+      inst.CRFS = Random(8);
+      inst.SUBOP10 = 0;
+      break;
+    case 4:
+      // mfcr, mcrxr
+      inst.OPCD = 31;
+      if (RandomBool())
+      {
+        inst.RD = DestGPR();
+        inst.SUBOP10 = 19;
+      }
+      else
+      {
+        inst.CRFD = Random(8);
+        inst.SUBOP10 = 512;
+      }
+      break;
+    default:
+      // mtcrf
+      inst.OPCD = 31;
+      inst.RS = SourceGPR();
+      inst.CRM = Random(256);
+      inst.SUBOP10 = 144;
+      break;
+    }
+    return inst;
+  }
+
+  UGeckoInstruction LoadStore()
+  {
+    // lwz, lbz, stw, stb, lhz, lha, sth, lfs, lfd, stfs, stfd
+    static constexpr std::array<u32, 11> d = {32, 34, 36, 38, 40, 42, 44, 48, 50, 52, 54};
+
+    UGeckoInstruction inst{};
+    if (Random(4) == 0)
+    {
+      // psq_l, psq_st with GQR0, which is always set up for unscaled floats
+      inst.OPCD = RandomBool() ? 56 : 60;
+      inst.FD = FPR();
+      inst.RA = SCRATCH_BASE_GPR;
+      inst.W = RandomBool();
+      inst.I = 0;
+      inst.SIMM_12 = Displacement(8);
+      return inst;
+    }
+
+    inst.OPCD = d[Random(d.size())];
+    const bool is_fp = inst.OPCD >= 48;
+    const bool is_load = inst.OPCD == 32 || inst.OPCD == 34 || inst.OPCD == 40 ||
+                         inst.OPCD == 42 || inst.OPCD == 48 || inst.OPCD == 50;
+    inst.RD = is_fp ? FPR() : (is_load ? DestGPR() : SourceGPR());
+    inst.RA = SCRATCH_BASE_GPR;
+    inst.SIMM_16 = static_cast<s16>(Displacement(8));
+    return inst;
+  }
+
+  UGeckoInstruction FloatingPoint()
+  {
+    // A-form: fdiv, fsub, fadd, fsel, fmul, fmsub, fmadd, fnmsub, fnmadd
+    static constexpr std::array<u32, 9> a = {18, 20, 21, 23, 25, 28, 29, 30, 31};
+    // X-form: fcmpu, frsp, fctiwz, fneg, fmr, fnabs, fabs
+    static constexpr std::array<u32, 7> x = {0, 12, 15, 40, 72, 136, 264};
+
+    UGeckoInstruction inst{};
+    if (RandomBool())
+    {
+      // Double (63) or single (59) precision. fsel only exists in double precision.
+      inst.SUBOP5 = a[Random(a.size())];
+      inst.OPCD = inst.SUBOP5 != 23 && RandomBool() ? 59 : 63;
+      inst.FD = FPR();
+      inst.FA = FPR();
+      inst.FB = inst.SUBOP5 == 25 ? 0 : FPR();
+      inst.FC = inst.SUBOP5 >= 23 ? FPR() : 0;
+    }
+    else
+    {
+      inst.OPCD = 63;
+      inst.SUBOP10 = x[Random(x.size())];
+      if (inst.SUBOP10 == 0)
+      {
+        inst.CRFD = Random(8);
+        inst.FA = FPR();
+      }
+      else
+      {
+        inst.FD = FPR();
+      }
+      inst.FB = FPR();
+    }
+    return inst;
+  }
+
+  UGeckoInstruction PairedSingle()
+  {
+    // A-form: ps_sum0, ps_sum1, ps_muls0, ps_muls1, ps_madds0, ps_madds1, ps_div, ps_sub, ps_add,
+    // ps_sel, ps_mul, ps_msub, ps_madd, ps_nmsub, ps_nmadd
+    static constexpr std::array<u32, 15> a = {10, 11, 12, 13, 14, 15, 18, 20,
+                                              21, 23, 25, 28, 29, 30, 31};
+    // X-form: ps_cmpu0, ps_neg, ps_mr, ps_nabs, ps_abs, ps_merge00/01/10/11
+    static constexpr std::array<u32, 9> x = {0, 40, 72, 136, 264, 528, 560, 592, 624};
+
+    UGeckoInstruction inst{};
+    inst.OPCD = 4;
+    if (RandomBool())
+    {
+      inst.SUBOP5 = a[Random(a.size())];
+      const bool uses_b = inst.SUBOP5 != 12 && inst.SUBOP5 != 13 && inst.SUBOP5 != 25;
+      const bool uses_c = inst.SUBOP5 < 18 || inst.SUBOP5 >= 23;
+      inst.FD = FPR();
+      inst.FA = FPR();
+      inst.FB = uses_b ? FPR() : 0;
+      inst.FC = uses_c ? FPR() : 0;
+    }
+    else
+    {
+      inst.SUBOP10 = x[Random(x.size())];
+      if (inst.SUBOP10 == 0)
+      {
+        inst.CRFD = Random(8);
+        inst.FA = FPR();
+      }
+      else
+      {
+        inst.FD = FPR();
+        inst.FA = inst.SUBOP10 >= 528 ? FPR() : 0;
+      }
+      inst.FB = FPR();
+    }
+    return inst;
+  }
+
+  std::mt19937 m_rng;
+};
+
+void WriteBlock(const std::vector<u32>& code)
+{
+  for (size_t i = 0; i < code.size(); ++i)
+    Memory::Write_U32(code[i], CODE_ADDRESS + static_cast<u32>(i * sizeof(u32)));
+}
+
+CPUStateSnapshot RunInterpreter(const CPUStateSnapshot& initial, size_t instruction_count)
+{
+  LoadSnapshot(initial);
+
+  Interpreter* const interpreter = Interpreter::getInstance();
+  for (size_t i = 0; i < instruction_count && PowerPC::ppcState.pc != RETURN_ADDRESS; ++i)
+    interpreter->SingleStepInner();
+
+  return SaveSnapshot();
+}
+
+CPUStateSnapshot RunCore(CPUCoreBase* core, CoreTiming::EventType* stop_event,
+                         const CPUStateSnapshot& initial)
+{
+  LoadSnapshot(initial);
+  core->ClearCache();
+
+  // A core may need one step to compile the block before it can run it. The stop event ends the
+  // timing slice right after the block, which makes the JIT dispatchers return since the CPU
+  // isn't in the running state.
+  for (int attempt = 0; attempt < 2 && PowerPC::ppcState.pc != RETURN_ADDRESS; ++attempt)
+  {
+    CoreTiming::ScheduleEvent(1, stop_event);
+    core->SingleStep();
+  }
+
+  return SaveSnapshot();
+}
+
+std::string DescribeBlock(const std::vector<u32>& code)
+{
+  std::string description;
+  for (size_t i = 0; i < code.size(); ++i)
+  {
+    const u32 address = CODE_ADDRESS + static_cast<u32>(i * sizeof(u32));
+    description += fmt::format("  {:08x}  {:08x}  {}\n", address, code[i],
+                               Common::GekkoDisassembler::Disassemble(code[i], address));
+  }
+  return description;
+}
+
+std::string DescribeDifferences(const CPUStateSnapshot& expected, const CPUStateSnapshot& actual)
+{
+  std::string description;
+  const auto compare = [&description](const std::string& name, u64 e, u64 a) {
+    if (e != a)
+      description += fmt::format("  {}: expected {:x}, got {:x}\n", name, e, a);
+  };
+
+  for (size_t i = 0; i < expected.gpr.size(); ++i)
+    compare(fmt::format("r{}", i), expected.gpr[i], actual.gpr[i]);
+  for (size_t i = 0; i < expected.ps0.size(); ++i)
+  {
+    compare(fmt::format("f{}.ps0", i), expected.ps0[i], actual.ps0[i]);
+    compare(fmt::format("f{}.ps1", i), expected.ps1[i], actual.ps1[i]);
+  }
+  compare("cr", expected.cr, actual.cr);
+  compare("xer", expected.xer, actual.xer);
+  compare("lr", expected.lr, actual.lr);
+  compare("ctr", expected.ctr, actual.ctr);
+  compare("pc", expected.pc, actual.pc);
+  compare("msr", expected.msr, actual.msr);
+  for (size_t i = 0; i < expected.scratch.size(); ++i)
+  {
+    compare(fmt::format("mem[{:08x}]", SCRATCH_ADDRESS + i), expected.scratch[i],
+            actual.scratch[i]);
+  }
+  return description;
+}
+
+void TimedCallbackNoop(u64, s64)
+{
+}
+
+struct TestCase
+{
+  u32 seed;
+  std::vector<u32> code;
+  CPUStateSnapshot initial;
+  CPUStateSnapshot expected;
+};
+}  // namespace
+
+TEST(PowerPCDifferential, RandomBlocks)
+{
+  ScopeInit guard;
+  if (!guard.UserDirectoryExists())
+    return;
+
+  CoreTiming::EventType* const stop_event =
+      CoreTiming::RegisterEvent("DifferentialTestStop", TimedCallbackNoop);
+
+  // The interpreter is the reference.
+  std::mt19937 seed_rng(SEED);
+  std::vector<TestCase> test_cases;
+  for (int i = 0; i < BLOCK_COUNT; ++i)
+  {
+    TestCase& test_case = test_cases.emplace_back();
+    test_case.seed = static_cast<u32>(seed_rng());
+
+    InstructionGenerator generator(test_case.seed);
+    test_case.code = generator.GenerateBlock();
+    test_case.initial = generator.GenerateState();
+
+    WriteBlock(test_case.code);
+    test_case.expected = RunInterpreter(test_case.initial, test_case.code.size());
+    ASSERT_EQ(RETURN_ADDRESS, test_case.expected.pc) << DescribeBlock(test_case.code);
+  }
+
+  for (const PowerPC::CPUCore core_type : PowerPC::AvailableCPUCores())
+  {
+    if (core_type == PowerPC::CPUCore::Interpreter)
+      continue;
+
+    CPUCoreBase* const core = JitInterface::InitJitCore(core_type);
+    ASSERT_NE(nullptr, core);
+
+    for (const TestCase& test_case : test_cases)
+    {
+      WriteBlock(test_case.code);
+      const CPUStateSnapshot actual = RunCore(core, stop_event, test_case.initial);
+
+      EXPECT_TRUE(actual == test_case.expected)
+          << fmt::format("{} differs from the interpreter for seed {:#x}:\n{}Differences:\n{}",
+                         core->GetName(), test_case.seed, DescribeBlock(test_case.code),
+                         DescribeDifferences(test_case.expected, actual));
+    }
+
+    JitInterface::Shutdown();
+  }
+}
@@ -0,0 +1,131 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cmath>
+#include <random>
+
+#include "Common/BitUtils.h"
+#include "Common/CommonTypes.h"
+#include "Common/FPURoundMode.h"
+#include "Core/PowerPC/Gekko.h"
+#include "Core/PowerPC/Interpreter/Interpreter_FPUtils.h"
+#include "Core/PowerPC/Interpreter/Interpreter_PairedUtils.h"
+
+#include "TestValues.h"
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+namespace
+{
+using PairedOp = PairedResult (*)(UReg_FPSCR*, double, double, double, double);
+using ScalarOp = FPResult (*)(UReg_FPSCR*, double, double);
+
+constexpr int ITERATIONS_PER_MODE = 20000;
+
+// Mostly ordinary single-precision values, which is what the packed path handles, with enough
+// special and boundary values mixed in to exercise the fallback and the NI flushing.
+double RandomOperand(std::mt19937_64& rng)
+{
+  switch (rng() % 8)
+  {
+  case 0:
+    return Common::BitCast<double>(double_test_values[rng() % double_test_values.size()]);
+  case 1:
+    return Common::BitCast<double>(rng());
+  case 2:
+    // Around the smallest normal single
+    return std::ldexp(std::uniform_real_distribution<double>(-4.0, 4.0)(rng), -127);
+  default:
+    return static_cast<float>(std::uniform_real_distribution<double>(-1e6, 1e6)(rng));
+  }
+}
+
+// The per-element implementation the interpreter used before the packed path existed.
+PairedResult ScalarReference(ScalarOp op, UReg_FPSCR* fpscr, double a0, double a1, double b0,
+                             double b1)
+{
+  const float ps0 = ForceSingle(*fpscr, op(fpscr, a0, b0).value);
+  const float ps1 = ForceSingle(*fpscr, op(fpscr, a1, b1).value);
+  return {ps0, ps1};
+}
+
+void CompareWithScalar(PairedOp paired, ScalarOp scalar)
+{
+  std::mt19937_64 rng(0x5EED);
+
+  for (const bool ni : {false, true})
+  {
+    for (const auto rn : {FPURoundMode::ROUND_NEAR, FPURoundMode::ROUND_CHOP,
+                          FPURoundMode::ROUND_UP, FPURoundMode::ROUND_DOWN})
+    {
+      FPURoundMode::SetSIMDMode(rn, ni);
+
+      for (int i = 0; i < ITERATIONS_PER_MODE; ++i)
+      {
+        const double a0 = RandomOperand(rng);
+        const double a1 = RandomOperand(rng);
+        const double b0 = RandomOperand(rng);
+        const double b1 = RandomOperand(rng);
+
+        UReg_FPSCR expected_fpscr;
+        expected_fpscr.RN = rn;
+        expected_fpscr.NI = ni;
+        UReg_FPSCR actual_fpscr = expected_fpscr;
+
+        const PairedResult expected =
+            ScalarReference(scalar, &expected_fpscr, a0, a1, b0, b1);
+        const PairedResult actual = paired(&actual_fpscr, a0, a1, b0, b1);
+
+        const u32 expected_ps0 = Common::BitCast<u32>(expected.ps0);
+        const u32 expected_ps1 = Common::BitCast<u32>(expected.ps1);
+        const u32 actual_ps0 = Common::BitCast<u32>(actual.ps0);
+        const u32 actual_ps1 = Common::BitCast<u32>(actual.ps1);
+
+        const auto describe = [&] {
+          return fmt::format("ni={} rn={} a=({:016x}, {:016x}) b=({:016x}, {:016x})", ni,
+                             static_cast<u32>(rn), Common::BitCast<u64>(a0),
+                             Common::BitCast<u64>(a1), Common::BitCast<u64>(b0),
+                             Common::BitCast<u64>(b1));
+        };
+
+        ASSERT_EQ(expected_ps0, actual_ps0) << describe();
+        ASSERT_EQ(expected_ps1, actual_ps1) << describe();
+        ASSERT_EQ(expected_fpscr.Hex, actual_fpscr.Hex) << describe();
+      }
+    }
+  }
+
+  FPURoundMode::SetSIMDMode(FPURoundMode::ROUND_NEAR, false);
+}
+
+PairedResult PairedMul25Bit(UReg_FPSCR* fpscr, double a0, double a1, double c0, double c1)
+{
+  return PairedMul(fpscr, a0, a1, Force25Bit(c0), Force25Bit(c1));
+}
+
+FPResult ScalarMul25Bit(UReg_FPSCR* fpscr, double a, double c)
+{
+  return NI_mul(fpscr, a, Force25Bit(c));
+}
+}  // namespace
+
+TEST(PairedSingle, Add)
+{
+  CompareWithScalar(PairedAdd, NI_add);
+}
+
+TEST(PairedSingle, Sub)
+{
+  CompareWithScalar(PairedSub, NI_sub);
+}
+
+TEST(PairedSingle, Mul)
+{
+  CompareWithScalar(PairedMul25Bit, ScalarMul25Bit);
+}
+
+TEST(PairedSingle, Div)
+{
+  CompareWithScalar(PairedDiv, NI_div);
+}
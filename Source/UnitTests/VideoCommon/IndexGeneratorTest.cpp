@@ -0,0 +1,182 @@
+// Copyright 2026 Dolphin Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <initializer_list>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Common/CommonTypes.h"
+#include "VideoCommon/IndexGenerator.h"
+#include "VideoCommon/OpcodeDecoding.h"
+#include "VideoCommon/VideoConfig.h"
+
+using OpcodeDecoder::Primitive;
+
+namespace
+{
+constexpr u16 PRIMITIVE_RESTART = 0xFFFF;
+
+// Reference implementation, matching the original scalar code in IndexGenerator.cpp.
+class ReferenceIndices
+{
+public:
+  explicit ReferenceIndices(bool pr) : m_pr(pr) {}
+
+  std::vector<u16> Generate(Primitive primitive, u32 num_verts, u32 index)
+  {
+    m_indices.clear();
+    switch (primitive)
+    {
+    case Primitive::GX_DRAW_QUADS:
+    case Primitive::GX_DRAW_QUADS_2:
+      AddQuads(num_verts, index);
+      break;
+    case Primitive::GX_DRAW_TRIANGLES:
+      for (u32 i = 2; i < num_verts; i += 3)
+        Triangle(index + i - 2, index + i - 1, index + i);
+      break;
+    case Primitive::GX_DRAW_TRIANGLE_STRIP:
+      AddStrip(num_verts, index);
+      break;
+    case Primitive::GX_DRAW_TRIANGLE_FAN:
+      AddFan(num_verts, index);
+      break;
+    case Primitive::GX_DRAW_LINES:
+      for (u32 i = 1; i < num_verts; i += 2)
+        Push({index + i - 1, index + i});
+      break;
+    case Primitive::GX_DRAW_LINE_STRIP:
+      for (u32 i = 1; i < num_verts; ++i)
+        Push({index + i - 1, index + i});
+      break;
+    case Primitive::GX_DRAW_POINTS:
+      for (u32 i = 0; i < num_verts; ++i)
+        Push({index + i});
+      break;
+    }
+    return m_indices;
+  }
+
+private:
+  void Push(std::initializer_list<u32> indices)
+  {
+    for (u32 index : indices)
+      m_indices.push_back(static_cast<u16>(index));
+  }
+
+  void Triangle(u32 index1, u32 index2, u32 index3)
+  {
+    Push({index1, index2, index3});
+    if (m_pr)
+      Push({PRIMITIVE_RESTART});
+  }
+
+  void AddStrip(u32 num_verts, u32 index)
+  {
+    if (m_pr)
+    {
+      for (u32 i = 0; i < num_verts; ++i)
+        Push({index + i});
+      Push({PRIMITIVE_RESTART});
+      return;
+    }
+
+    bool wind = false;
+    for (u32 i = 2; i < num_verts; ++i)
+    {
+      Triangle(index + i - 2, index + i - !wind, index + i - wind);
+      wind ^= true;
+    }
+  }
+
+  void AddFan(u32 num_verts, u32 index)
+  {
+    u32 i = 2;
+    if (m_pr)
+    {
+      for (; i + 3 <= num_verts; i += 3)
+        Push({index + i - 1, index + i, index, index + i + 1, index + i + 2, PRIMITIVE_RESTART});
+      for (; i + 2 <= num_verts; i += 2)
+        Push({index + i - 1, index + i, index, index + i + 1, PRIMITIVE_RESTART});
+    }
+    for (; i < num_verts; ++i)
+      Triangle(index, index + i - 1, index + i);
+  }
+
+  void AddQuads(u32 num_verts, u32 index)
+  {
+    u32 i = 3;
+    for (; i < num_verts; i += 4)
+    {
+      if (m_pr)
+      {
+        Push({index + i - 2, index + i - 1, index + i - 3, index + i, PRIMITIVE_RESTART});
+      }
+      else
+      {
+        Triangle(index + i - 3, index + i - 2, index + i - 1);
+        Triangle(index + i - 3, index + i - 1, index + i);
+      }
+    }
+    if (i == num_verts)
+      Triangle(index + num_verts - 3, index + num_verts - 2, index + num_verts - 1);
+  }
+
+  bool m_pr;
+  std::vector<u16> m_indices;
+};
+
+constexpr Primitive PRIMITIVES[] = {
+    Primitive::GX_DRAW_QUADS,          Primitive::GX_DRAW_QUADS_2,
+    Primitive::GX_DRAW_TRIANGLES,      Primitive::GX_DRAW_TRIANGLE_STRIP,
+    Primitive::GX_DRAW_TRIANGLE_FAN,   Primitive::GX_DRAW_LINES,
+    Primitive::GX_DRAW_LINE_STRIP,     Primitive::GX_DRAW_POINTS,
+};
+}  // namespace
+
+class IndexGeneratorTest : public testing::TestWithParam<bool>
+{
+protected:
+  void SetUp() override
+  {
+    g_Config.backend_info.bSupportsPrimitiveRestart = GetParam();
+    m_generator.Init();
+  }
+
+  IndexGenerator m_generator;
+  // Large enough for the worst case of 2 indices per vertex plus a guard area.
+  std::vector<u16> m_buffer = std::vector<u16>(4096);
+};
+
+TEST_P(IndexGeneratorTest, MatchesReference)
+{
+  ReferenceIndices reference(GetParam());
+
+  for (Primitive primitive : PRIMITIVES)
+  {
+    for (u32 base : {0u, 1u, 1000u})
+    {
+      for (u32 num_verts = 0; num_verts < 200; ++num_verts)
+      {
+        std::fill(m_buffer.begin(), m_buffer.end(), 0x5A5A);
+        m_generator.Start(m_buffer.data());
+        // Offset the batch so that the pattern's base index is exercised.
+        m_generator.AddIndices(Primitive::GX_DRAW_POINTS, base);
+        const u32 start = m_generator.GetIndexLen();
+        m_generator.AddIndices(primitive, num_verts);
+
+        const std::vector<u16> expected = reference.Generate(primitive, num_verts, base);
+        const std::vector<u16> actual(m_buffer.begin() + start,
+                                      m_buffer.begin() + m_generator.GetIndexLen());
+        EXPECT_EQ(expected, actual) << "primitive " << static_cast<int>(primitive) << ", base "
+                                    << base << ", " << num_verts << " vertices";
+        EXPECT_EQ(m_buffer[m_generator.GetIndexLen()], 0x5A5A);
+        EXPECT_EQ(m_generator.GetNumVerts(), base + num_verts);
+      }
+    }
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(PrimitiveRestart, IndexGeneratorTest, testing::Bool());